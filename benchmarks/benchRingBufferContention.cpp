@@ -0,0 +1,129 @@
+/**
+* @file benchRingBufferContention.cpp
+* @brief A contention benchmark comparing RingBufferMPMC with RingBufferGuarded and RingBufferFutexGuarded.
+*
+* For each of 1, 2, 4 and 8 producers, an equal number of consumer threads drain the ring buffer.
+* The elapsed time to pass all elements through is reported as millions of elements per second.
+* The RingBufferMPMC producers and consumers yield when full or empty respectively. The RingBufferGuarded
+* and RingBufferFutexGuarded producers and consumers block when full or empty respectively.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "RingBufferMPMC.hpp"
+#include "RingBufferGuarded.hpp"
+#include "RingBufferFutexGuarded.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <functional>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+namespace
+{
+    constexpr size_t ringBufferSize = 1024;
+    constexpr unsigned int numValuesPerProducer = 200000;
+
+    double runThreads( unsigned int numProducers,
+                       const function< void() > & producerTask, const function< void() > & consumerTask )
+    {
+        vector< thread > threads;
+        threads.reserve( numProducers * 2 );
+
+        auto startTime = chrono::steady_clock::now();
+        for ( unsigned int i = 0; i != numProducers; ++i )
+        {
+            threads.emplace_back( consumerTask );
+            threads.emplace_back( producerTask );
+        }
+        for ( auto & t : threads ) t.join();
+        chrono::duration< double > elapsed = chrono::steady_clock::now() - startTime;
+
+        return double( numProducers ) * numValuesPerProducer / elapsed.count() / 1.0e6;
+    }
+
+    double benchMPMC( unsigned int numProducers )
+    {
+        RingBufferMPMC< unsigned int > ringBuffer{ ringBufferSize };
+
+        auto producerTask = [ &ringBuffer ]()
+        {
+            for ( unsigned int n = 0; n != numValuesPerProducer; )
+            {
+                if ( ringBuffer.tryPut( n ) ) ++n;
+                else this_thread::yield();
+            }
+        };
+        auto consumerTask = [ &ringBuffer ]()
+        {
+            for ( unsigned int n = 0; n != numValuesPerProducer; )
+            {
+                if ( ringBuffer.tryGet() ) ++n;
+                else this_thread::yield();
+            }
+        };
+
+        return runThreads( numProducers, producerTask, consumerTask );
+    }
+
+    double benchGuarded( unsigned int numProducers )
+    {
+        RingBufferGuarded< unsigned int > ringBuffer{ ringBufferSize };
+
+        auto producerTask = [ &ringBuffer ]()
+        {
+            for ( unsigned int n = 0; n != numValuesPerProducer; ++n )
+                ringBuffer.put( n );
+        };
+        auto consumerTask = [ &ringBuffer ]()
+        {
+            for ( unsigned int n = 0; n != numValuesPerProducer; ++n )
+                ringBuffer.get();
+        };
+
+        return runThreads( numProducers, producerTask, consumerTask );
+    }
+
+    double benchFutexGuarded( unsigned int numProducers )
+    {
+        RingBufferFutexGuarded< unsigned int > ringBuffer{ ringBufferSize };
+
+        auto producerTask = [ &ringBuffer ]()
+        {
+            for ( unsigned int n = 0; n != numValuesPerProducer; ++n )
+                ringBuffer.put( n );
+        };
+        auto consumerTask = [ &ringBuffer ]()
+        {
+            for ( unsigned int n = 0; n != numValuesPerProducer; ++n )
+                ringBuffer.get();
+        };
+
+        return runThreads( numProducers, producerTask, consumerTask );
+    }
+}
+
+int main()
+{
+    cout << "Ring buffer contention, producers = consumers, " << numValuesPerProducer
+         << " elements per producer, " << ringBufferSize << " element ring buffer" << endl;
+    cout << setw( 10 ) << "Producers" << setw( 16 ) << "MPMC Mops/s" << setw( 16 ) << "Guarded Mops/s"
+         << setw( 16 ) << "Futex Mops/s" << endl;
+
+    for ( unsigned int numProducers : { 1U, 2U, 4U, 8U } )
+    {
+        const double mpmc = benchMPMC( numProducers );
+        const double guarded = benchGuarded( numProducers );
+        const double futexGuarded = benchFutexGuarded( numProducers );
+        cout << setw( 10 ) << numProducers << fixed << setprecision( 2 )
+             << setw( 16 ) << mpmc << setw( 16 ) << guarded << setw( 16 ) << futexGuarded << endl;
+    }
+
+    return 0;
+}
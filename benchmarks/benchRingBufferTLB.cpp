@@ -0,0 +1,93 @@
+/**
+* @file benchRingBufferTLB.cpp
+* @brief A benchmark comparing the storage backends available to large ring buffers.
+*
+* A large RingBufferSimple is created with each of the RingBufferStorageOptions page modes of interest.
+* The first lap through the ring, where every page is touched for the first time, and the average of subsequent
+* laps are reported in nanoseconds per element. The first lap exposes page fault costs, which pre-faulting
+* removes. Subsequent laps expose TLB reach, which huge pages extend. Backends unavailable on the host
+* (e.g., no huge pages reserved) are reported as such.
+*
+* The number of elements may be specified as the first argument. The default is 4M 64 bit elements (32MB).
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "RingBufferSimple.hpp"
+
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <cstdlib>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+namespace
+{
+    constexpr size_t blockSize = 256;
+    constexpr unsigned int numSteadyLaps = 8;
+
+    double runLap( RingBufferSimple< uint64_t > & ringBuffer, vector< uint64_t > & block )
+    {
+        const size_t numBlocks = ringBuffer.getSize() / blockSize;
+
+        auto startTime = chrono::steady_clock::now();
+        for ( size_t i = 0; i != numBlocks; ++i )
+        {
+            ringBuffer.put( block.data(), blockSize );
+            ringBuffer.get( block.data(), blockSize );
+        }
+        chrono::duration< double, nano > elapsed = chrono::steady_clock::now() - startTime;
+
+        return elapsed.count() / double( numBlocks * blockSize );
+    }
+
+    void bench( const char * name, size_t numElements, const RingBufferStorageOptions & options )
+    {
+        cout << setw( 20 ) << name;
+        try
+        {
+            RingBufferSimple< uint64_t > ringBuffer{ numElements, options };
+            vector< uint64_t > block( blockSize, 1 );
+
+            const double firstLap = runLap( ringBuffer, block );
+            double steadyLaps = 0.0;
+            for ( unsigned int i = 0; i != numSteadyLaps; ++i ) steadyLaps += runLap( ringBuffer, block );
+
+            cout << fixed << setprecision( 3 ) << setw( 16 ) << firstLap << setw( 16 ) << steadyLaps / numSteadyLaps << endl;
+        }
+        catch ( RingBufferStorageError & e )
+        {
+            cout << "  unavailable (" << e.what() << ")" << endl;
+        }
+    }
+}
+
+int main( int argc, char * argv[] )
+{
+    const size_t numElements = argc > 1 ? size_t( strtoull( argv[ 1 ], nullptr, 0 ) ) : size_t( 1 ) << 22;
+
+    cout << "Ring buffer storage, " << numElements << " 64 bit elements, bulk put/get of " << blockSize << endl;
+    cout << setw( 20 ) << "Storage" << setw( 16 ) << "First ns/elem" << setw( 16 ) << "Steady ns/elem" << endl;
+
+    RingBufferStorageOptions options{};
+    bench( "Heap", numElements, options );
+
+    options.prefault = true;
+    bench( "Mapped, prefault", numElements, options );
+
+    options.pageMode = RingBufferStorageOptions::PageMode::TransparentHuge;
+    bench( "THP, prefault", numElements, options );
+
+    options.pageMode = RingBufferStorageOptions::PageMode::HugeTlb;
+    bench( "HugeTlb, prefault", numElements, options );
+
+    options.lockMemory = true;
+    bench( "HugeTlb, locked", numElements, options );
+
+    return 0;
+}
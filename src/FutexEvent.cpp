@@ -0,0 +1,40 @@
+/**
+* @file FutexEvent.cpp
+* @brief The Implementation for FutexEvent
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "FutexEvent.hpp"
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <climits>
+#else
+#include <thread>
+#endif
+
+using namespace ReiserRT::Core;
+
+// The futex system call operates upon the 32 bit word within our atomic.
+static_assert( sizeof( std::atomic< FutexEvent::KeyType > ) == sizeof( uint32_t ),
+        "FutexEvent requires an atomic futex word of 32 bits!" );
+
+void FutexEvent::wait( KeyType key ) noexcept
+{
+#ifdef __linux__
+    // Returns immediately (EAGAIN) if the word has already changed. Interruptions (EINTR) are simply spurious wakes.
+    syscall( SYS_futex, reinterpret_cast< uint32_t * >( &futexWord ), FUTEX_WAIT_PRIVATE, key, nullptr, nullptr, 0 );
+#else
+    if ( futexWord.load( std::memory_order_seq_cst ) == key ) std::this_thread::yield();
+#endif
+}
+
+void FutexEvent::wakeAll() noexcept
+{
+#ifdef __linux__
+    syscall( SYS_futex, reinterpret_cast< uint32_t * >( &futexWord ), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0 );
+#endif
+}
@@ -0,0 +1,195 @@
+/**
+* @file FutexEvent.hpp
+* @brief The Specification file for FutexEvent
+*
+* This file came into existence to allow lock-free structures to block when they must (e.g., get when empty)
+* without locking a Mutex or signaling a condition variable on every operation, whether anyone is waiting or not.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_FUTEXEVENT_HPP
+#define REISERRT_CORE_FUTEXEVENT_HPP
+
+#include "ReiserRT_CoreExport.h"
+
+#include "RingBufferSizing.hpp"
+
+#include <atomic>
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The FutexEvent Class
+        *
+        * This class is an "event count". It allows a thread to wait for a condition that another thread makes true
+        * without a lock. A waiter first invokes prepareWait, then re-checks its condition and either invokes
+        * cancelWait (the condition became true) or commitWait (it did not). A notifier makes the condition true and
+        * then invokes notify.
+        *
+        * A single 32 bit word, the futex word, holds an epoch and a "waiters" flag in its least significant bit.
+        * The prepareWait operation sets the flag and observes the word. The notify operation costs a fence and a
+        * load when the flag is clear. Only when it is set does notify clear it, advancing the epoch in the same
+        * step, and issue a futex wake system call for all sleepers. Subsequent notifications find the flag clear
+        * and make no system call until a thread prepares to wait again. The commitWait operation sleeps in a
+        * futex wait system call only if the word is unchanged since prepareWait. Hence, no notification can be
+        * lost between the re-check and the sleep.
+        *
+        * Unlike most classes within this library, FutexEvent does not employ the "pImple" idiom. Its fast path
+        * must be inlined. Only the system calls are made out of line. Under Linux, the futex system call is
+        * employed. Elsewhere, waiting degrades to yielding the processor.
+        *
+        * @note Waiters may be woken spuriously. They must always re-check their condition.
+        */
+        class ReiserRT_Core_EXPORT FutexEvent
+        {
+        public:
+            /**
+            * @brief The Key Type
+            *
+            * This is the type of the futex word observed by prepareWait and passed to commitWait.
+            */
+            using KeyType = uint32_t;
+
+            /**
+            * @brief Default Constructor for FutexEvent
+            *
+            * This constructor instantiates a FutexEvent with no waiters.
+            */
+            FutexEvent() = default;
+
+            /**
+            * @brief Destructor for FutexEvent
+            *
+            * Default behavior for destructor of FutexEvent is all that is required. There must be no waiters.
+            */
+            ~FutexEvent() = default;
+
+            /**
+            * @brief Copy Constructor for FutexEvent
+            *
+            * Copying FutexEvent is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a FutexEvent.
+            */
+            FutexEvent( const FutexEvent & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for FutexEvent
+            *
+            * Copy assignment of FutexEvent is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a FutexEvent.
+            */
+            FutexEvent & operator =( const FutexEvent & another ) = delete;
+
+            /**
+            * @brief Move Constructor for FutexEvent
+            *
+            * Moving FutexEvent is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a FutexEvent.
+            */
+            FutexEvent( FutexEvent && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for FutexEvent
+            *
+            * Move assignment of FutexEvent is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a FutexEvent.
+            */
+            FutexEvent & operator =( FutexEvent && another ) = delete;
+
+            /**
+            * @brief The Prepare Wait Operation
+            *
+            * This operation sets the waiters flag and observes the futex word. The caller must then re-check its
+            * condition and invoke exactly one of cancelWait or commitWait.
+            *
+            * @return Returns the futex word observed, to be passed to commitWait.
+            */
+            inline KeyType prepareWait() noexcept
+            {
+                return futexWord.fetch_or( waitersFlag, std::memory_order_seq_cst ) | waitersFlag;
+            }
+
+            /**
+            * @brief The Cancel Wait Operation
+            *
+            * This operation abandons a wait prepared for. The waiters flag is left set, as other threads may
+            * have set it too. At worst, the next notification makes one unnecessary system call.
+            */
+            inline void cancelWait() noexcept {}
+
+            /**
+            * @brief The Commit Wait Operation
+            *
+            * This operation blocks the invoking thread until notified, unless a notification has already advanced
+            * the epoch since prepareWait.
+            *
+            * @param key The futex word returned by prepareWait.
+            */
+            inline void commitWait( KeyType key ) noexcept { wait( key ); }
+
+            /**
+            * @brief The Notify Operation
+            *
+            * This operation wakes all waiters, if the waiters flag is set. It must be invoked after the condition
+            * waited upon has been made true.
+            */
+            inline void notify() noexcept
+            {
+                std::atomic_thread_fence( std::memory_order_seq_cst );
+                KeyType word = futexWord.load( std::memory_order_relaxed );
+                while ( 0 != ( word & waitersFlag ) )
+                {
+                    // Adding one clears the flag and advances the epoch. Only one notifier succeeds and wakes.
+                    if ( futexWord.compare_exchange_weak( word, word + 1,
+                                                          std::memory_order_seq_cst, std::memory_order_relaxed ) )
+                    {
+                        wakeAll();
+                        break;
+                    }
+                }
+            }
+
+        private:
+            /**
+            * @brief The Wait Operation
+            *
+            * This operation sleeps in the kernel for as long as the futex word equals key.
+            *
+            * @param key The futex word returned by prepareWait.
+            */
+            void wait( KeyType key ) noexcept;
+
+            /**
+            * @brief The Wake All Operation
+            *
+            * This operation wakes all threads sleeping on the futex word.
+            */
+            void wakeAll() noexcept;
+
+            /**
+            * @brief The Waiters Flag
+            *
+            * This is the least significant bit of the futex word. The epoch occupies the remaining bits.
+            */
+            static constexpr KeyType waitersFlag = 1;
+
+            /**
+            * @brief The Futex Word
+            *
+            * This attribute holds the epoch and the waiters flag. It resides on a cache line of its own.
+            */
+            alignas( ringBufferCacheLineSize ) std::atomic< KeyType > futexWord{ 0 };
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_FUTEXEVENT_HPP */
@@ -13,8 +13,10 @@
 using namespace ReiserRT;
 using namespace ReiserRT::Core;
 
-MessageQueue::MessageQueue( size_t requestedNumElements, size_t requestedMaxMessageSize, bool enableDispatchLocking )
-  : MessageQueueBase( requestedNumElements, requestedMaxMessageSize, enableDispatchLocking )
+MessageQueue::MessageQueue( size_t requestedNumElements, size_t requestedMaxMessageSize, bool enableDispatchLocking,
+                            bool singleDispatcher, bool enableReadinessFd )
+  : MessageQueueBase( requestedNumElements, requestedMaxMessageSize, enableDispatchLocking, singleDispatcher,
+                      enableReadinessFd )
 {
 }
 
@@ -39,6 +41,17 @@ void MessageQueue::getAndDispatch( const WakeupCallFunctionType & wakeupFunctor
     dispatchMessage( pM );
 }
 
+bool MessageQueue::tryGetAndDispatch()
+{
+    // CookedMemoryManager ensures memory is returned to the raw pool should dispatch throw.
+    auto * pM = cookedTryGet();
+    if ( !pM ) return false;
+    CookedMemoryManager cookedMemoryManager{ this, pM };
+
+    dispatchMessage( pM );
+    return true;
+}
+
 void MessageQueue::purge()
 {
     // Note warning in documentation. We are assuming we are being used properly.
@@ -50,9 +50,16 @@ namespace ReiserRT
             * thread. By default this feature is disabled as there is a small performance penalty that a dispatch
             * loop must pay to support it. If a client must coordinate synchronous and asynchronous activity,
             * then a client should enable this feature. This cannot be changed after construction.
+            * @param singleDispatcher Set to true if only one thread ever dispatches. Messages are then retrieved
+            * outside of the queue's internal lock, shortening the time senders may be held up by the dispatcher.
+            * Dispatching from more than one thread with this set corrupts the queue.
+            * This cannot be changed after construction.
+            * @param enableReadinessFd Set to true to enable the readiness file descriptor (@see getReadinessFd).
+            * This allows one thread to service many message queues, along with sockets and timers, via epoll.
+            * This cannot be changed after construction.
             */
             explicit MessageQueue(size_t requestedNumElements, size_t requestedMaxMessageSize,
-                bool enableDispatchLocking = false );
+                bool enableDispatchLocking = false, bool singleDispatcher = false, bool enableReadinessFd = false );
 
             /**
             * @brief Destructor for MessageQueue
@@ -220,6 +227,19 @@ namespace ReiserRT
             */
             void getAndDispatch( const WakeupCallFunctionType & wakeupFunctor );
 
+            /**
+            * @brief The Try Get and Dispatch Operation
+            *
+            * This operation dispatches a message, as the getAndDispatch operation does, if one is available.
+            * It never blocks. A thread woken by the readiness file descriptor should invoke it until it returns false,
+            * which also clears readiness.
+            *
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation has been invoked.
+            *
+            * @return Returns true if a message was dispatched and false if the queue was empty.
+            */
+            bool tryGetAndDispatch();
+
             /**
             * @brief The Purge Operation
             *
@@ -273,6 +293,15 @@ namespace ReiserRT
             * enabled during construction.
             */
             using MessageQueueBase::getAutoDispatchLock;
+
+            /**
+            * @brief The Get Readiness File Descriptor Operation
+            *
+            * This operation defers to MessageQueueBase::getReadinessFd to obtain the readiness file descriptor.
+            *
+            * @return Returns the readiness file descriptor, or -1 if not enabled during construction.
+            */
+            using MessageQueueBase::getReadinessFd;
         };
 
     }
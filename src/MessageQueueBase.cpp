@@ -17,6 +17,7 @@
 #include <cstring>
 #include <thread>
 #include <mutex>
+#include <variant>
 
 using namespace ReiserRT::Core;
 
@@ -46,9 +47,11 @@ private:
     /**
     * @brief The Cooked Ring Buffer Type
     *
-    * Here we define our "cooked" ring buffer type
+    * Here we define our "cooked" ring buffer type. Any number of threads may send (put) messages. Either any
+    * number of threads or a single thread may dispatch (get) them, as specified at construction.
     */
-    using CookedRingBufferType = RingBufferGuarded< MessageBase * >;
+    using CookedRingBufferType = std::variant< RingBufferGuarded< MessageBase * >,
+                                               RingBufferGuarded< MessageBase *, MultiProducer, SingleConsumer > >;
 
     /**
     * @brief Mutex Pointer Type Declaration
@@ -113,10 +116,14 @@ private:
     * @param requestedNumElements The number of elements requested for the ObjectQueue. This will be the exact
     * maximum amount of messages that can either be enqueued or dequeued before blocking occurs.
     * @param theElementSize The maximum size of an element.
+    * @param enableDispatchLocking Set to true to enable the dispatch locking capability.
+    * @param singleDispatcher Set to true to employ a single consumer "cooked" ring buffer.
+    * @param enableReadinessFd Set to true to enable the readiness file descriptor of the "cooked" ring buffer.
     *
     * @throw Throws std::bad_alloc if memory requirements for the arena, or ring buffer internals cannot be satisfied.
     */
-    Imple( std::size_t theRequestedNumElements, std::size_t theElementSize, bool enableDispatchLocking );
+    Imple( std::size_t theRequestedNumElements, std::size_t theElementSize, bool enableDispatchLocking,
+           bool singleDispatcher, bool enableReadinessFd );
 
     /**
     * @brief Destructor for ObjectQueueBase::Imple
@@ -146,7 +153,7 @@ private:
     void abort()
     {
         aborted = true;
-        cookedRingBuffer.abort();
+        std::visit( []( auto & cooked ) { cooked.abort(); }, cookedRingBuffer );
         rawRingBuffer.abort();
     }
 
@@ -173,7 +180,7 @@ private:
     inline void cookedPutAndNotify( MessageBase * pCooked )
     {
         // Put cooked memory into the cooked ring buffer. The guarded ring buffer performs the notification.
-        cookedRingBuffer.put( pCooked );
+        std::visit( [ pCooked ]( auto & cooked ) { cooked.put( pCooked ); }, cookedRingBuffer );
     }
 
     /**
@@ -188,7 +195,22 @@ private:
     inline MessageBase * cookedWaitAndGet()
     {
         // Get cooked memory from the cooked ring buffer.
-        return cookedRingBuffer.get();
+        return std::visit( []( auto & cooked ) { return cooked.get(); }, cookedRingBuffer );
+    }
+
+    /**
+    * @brief The cookedTryGet Operation
+    *
+    * This operation is invoked to obtain cooked memory from the implementation without blocking.
+    *
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the "cooked" ring buffer becomes aborted.
+    *
+    * @return Returns a pointer to an abstract MessageBase object from the implementation, or nullptr if empty.
+    */
+    inline MessageBase * cookedTryGet()
+    {
+        // Try getting cooked memory from the cooked ring buffer. It clears readiness should it find empty.
+        return std::visit( []( auto & cooked ) { return cooked.tryGet().value_or( nullptr ); }, cookedRingBuffer );
     }
 
     /**
@@ -240,6 +262,21 @@ private:
     */
     static size_t getPaddedTypeAllocSize( size_t requestedElementSize );
 
+    /**
+    * @brief Make the Cooked Ring Buffer
+    *
+    * This operation constructs the "cooked" ring buffer alternative specified, in place. It is static as it
+    * is used at time of construction.
+    *
+    * @param theRequestedNumElements The number of elements requested.
+    * @param singleDispatcher Set to true for the single consumer alternative.
+    * @param enableReadinessFd Set to true to enable the readiness file descriptor.
+    *
+    * @return Returns the "cooked" ring buffer.
+    */
+    static CookedRingBufferType makeCookedRingBuffer( size_t theRequestedNumElements, bool singleDispatcher,
+                                                      bool enableReadinessFd );
+
     /**
     * @brief The Actual Requested Size
     *
@@ -352,13 +389,13 @@ void MessageQueueBase::AutoDispatchLock::unlock()
 }
 
 MessageQueueBase::Imple::Imple( std::size_t theRequestedNumElements, std::size_t theElementSize,
-                                bool enableDispatchLocking )
+                                bool enableDispatchLocking, bool singleDispatcher, bool enableReadinessFd )
   : requestedNumElements{ theRequestedNumElements }
   , elementSize{ getPaddedTypeAllocSize( theElementSize ) }
   , pMutex{ enableDispatchLocking ? new Mutex{} : nullptr }
   , arena{ new unsigned char [ elementSize * requestedNumElements ] }
   , rawRingBuffer{ theRequestedNumElements, true }
-  , cookedRingBuffer{ theRequestedNumElements }
+  , cookedRingBuffer{ makeCookedRingBuffer( theRequestedNumElements, singleDispatcher, enableReadinessFd ) }
 {
     // Prime the raw ring buffer with void pointers into our arena space. We do this with a lambda function.
     auto funk = [ this ]( size_t i )
@@ -370,7 +407,7 @@ MessageQueueBase::Imple::~Imple()
 {
     // Flush anything left in the cooked ring buffer.
     auto funk = []( void * pV ) { auto * pM = reinterpret_cast< MessageBase * >( pV ); pM->~MessageBase(); };
-    cookedRingBuffer.flush( funk );
+    std::visit( [ &funk ]( auto & cooked ) { cooked.flush( funk ); }, cookedRingBuffer );
 
     // Return our arena memory to the standard heap.
     delete[] arena;
@@ -461,10 +498,24 @@ size_t MessageQueueBase::Imple::getPaddedTypeAllocSize( size_t requestedElementS
             requestedElementSize;
 }
 
+MessageQueueBase::Imple::CookedRingBufferType MessageQueueBase::Imple::makeCookedRingBuffer(
+        size_t theRequestedNumElements, bool singleDispatcher, bool enableReadinessFd )
+{
+    // Ring buffers can be neither copied nor moved. Each alternative is constructed in place, within the return value.
+    if ( singleDispatcher )
+    {
+        return CookedRingBufferType{ std::in_place_index< 1 >, theRequestedNumElements, false, WaitPolicy{},
+                                     enableReadinessFd };
+    }
+    return CookedRingBufferType{ std::in_place_index< 0 >, theRequestedNumElements, false, WaitPolicy{},
+                                 enableReadinessFd };
+}
+
 
 MessageQueueBase::MessageQueueBase( std::size_t requestedNumElements, std::size_t requestedMaxMessageSize,
-                                    bool enableDispatchLocking )
-  : pImple{ new Imple{ requestedNumElements, requestedMaxMessageSize, enableDispatchLocking } }
+                                    bool enableDispatchLocking, bool singleDispatcher, bool enableReadinessFd )
+  : pImple{ new Imple{ requestedNumElements, requestedMaxMessageSize, enableDispatchLocking, singleDispatcher,
+                       enableReadinessFd } }
 {
 }
 
@@ -502,6 +553,11 @@ MessageBase * MessageQueueBase::cookedWaitAndGet()
     return pImple->cookedWaitAndGet();
 }
 
+MessageBase * MessageQueueBase::cookedTryGet()
+{
+    return pImple->cookedTryGet();
+}
+
 void MessageQueueBase::rawPutAndNotify( void * pRaw )
 {
     pImple->rawPutAndNotify( pRaw );
@@ -535,3 +591,8 @@ size_t MessageQueueBase::getElementSize() noexcept
 {
     return pImple->elementSize;
 }
+
+int MessageQueueBase::getReadinessFd() noexcept
+{
+    return std::visit( []( auto & cooked ) { return cooked.getReadinessFd(); }, pImple->cookedRingBuffer );
+}
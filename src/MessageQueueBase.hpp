@@ -475,9 +475,15 @@ namespace ReiserRT
             * thread. By default this feature is disabled as there is a small performance penalty that a dispatch
             * loop must pay to support it. If a client must coordinate synchronous and asynchronous activity,
             * then a client should enable this feature. This cannot be changed after construction.
+            * @param singleDispatcher Set to true if only one thread ever gets from the "cooked" ring buffer. It then
+            * retrieves each message outside of the ring buffer's internal lock (@see RingBufferGuardedBase).
+            * This cannot be changed after construction.
+            * @param enableReadinessFd Set to true to enable the readiness file descriptor of the "cooked" ring buffer.
+            * This cannot be changed after construction.
             */
             explicit MessageQueueBase( std::size_t requestedNumElements, std::size_t requestedMaxMessageSize,
-                                       bool enableDispatchLocking );
+                                       bool enableDispatchLocking, bool singleDispatcher = false,
+                                       bool enableReadinessFd = false );
 
             /**
              * @brief Destructor for MessageQueueBase
@@ -538,6 +544,18 @@ namespace ReiserRT
             */
             MessageBase * cookedWaitAndGet();
 
+            /**
+            * @brief The cookedTryGet Operation
+            *
+            * This operation is invoked to obtain cooked memory from the implementation without blocking.
+            * When empty is found, readiness is cleared.
+            *
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the "cooked" ring buffer becomes aborted.
+            *
+            * @return Returns a pointer to an abstract MessageBase object from the implementation, or nullptr if empty.
+            */
+            MessageBase * cookedTryGet();
+
             /**
             * @brief The rawPutAndNotify Operation
             *
@@ -604,6 +622,16 @@ namespace ReiserRT
             */
             size_t getElementSize() noexcept;
 
+            /**
+            * @brief Get the Readiness File Descriptor
+            *
+            * This operation retrieves a file descriptor that is readable whenever messages may be available, if enabled
+            * at construction. It may be waited upon with epoll (EPOLLIN), poll or select, alongside others.
+            *
+            * @return Returns the readiness file descriptor, or -1 if not enabled at construction.
+            */
+            int getReadinessFd() noexcept;
+
         private:
             /**
             * @brief MessageQueue Implementation Reference.
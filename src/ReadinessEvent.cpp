@@ -0,0 +1,73 @@
+/**
+* @file ReadinessEvent.cpp
+* @brief The Implementation for ReadinessEvent
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "ReadinessEvent.hpp"
+
+#include "ReiserRT_CoreExceptions.hpp"
+
+#ifdef __linux__
+#include <sys/eventfd.h>
+#else
+#include <fcntl.h>
+#endif
+#include <unistd.h>
+#include <cerrno>
+#include <cstdint>
+
+using namespace ReiserRT::Core;
+
+ReadinessEvent::ReadinessEvent()
+{
+#ifdef __linux__
+    readFd = writeFd = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+    if ( readFd < 0 ) throw ReadinessEventError{ "ReadinessEvent::ReadinessEvent: eventfd failed!" };
+#else
+    int fds[ 2 ];
+    if ( pipe( fds ) != 0 ) throw ReadinessEventError{ "ReadinessEvent::ReadinessEvent: pipe failed!" };
+    for ( int fd : fds )
+    {
+        fcntl( fd, F_SETFL, fcntl( fd, F_GETFL ) | O_NONBLOCK );
+        fcntl( fd, F_SETFD, FD_CLOEXEC );
+    }
+    readFd = fds[ 0 ];
+    writeFd = fds[ 1 ];
+#endif
+}
+
+ReadinessEvent::~ReadinessEvent()
+{
+    close( readFd );
+    if ( writeFd != readFd ) close( writeFd );
+}
+
+void ReadinessEvent::write() noexcept
+{
+    // Under Linux, this adds one to the eventfd counter. Elsewhere, a single byte is written to the pipe.
+    // Neither can fail, save for interruption, as writes are few between reads.
+#ifdef __linux__
+    const uint64_t one = 1;
+#else
+    const char one = 1;
+#endif
+    ssize_t n;
+    do { n = ::write( writeFd, &one, sizeof( one ) ); } while ( n < 0 && errno == EINTR );
+}
+
+void ReadinessEvent::read() noexcept
+{
+    // Under Linux, a single read zeroes the eventfd counter. Elsewhere, the pipe is read until empty, as
+    // a late write may have landed beside an earlier one. Either way, an empty descriptor reports EAGAIN.
+    uint64_t buf;
+    ssize_t n;
+    do { n = ::read( readFd, &buf, sizeof( buf ) ); } while ( n < 0 && errno == EINTR );
+#ifndef __linux__
+    while ( n > 0 )
+    {
+        do { n = ::read( readFd, &buf, sizeof( buf ) ); } while ( n < 0 && errno == EINTR );
+    }
+#endif
+}
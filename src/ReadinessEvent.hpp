@@ -0,0 +1,168 @@
+/**
+* @file ReadinessEvent.hpp
+* @brief The Specification file for ReadinessEvent
+*
+* This file came into existence to allow one thread to wait upon many queues, along with sockets and timers,
+* through epoll (or poll, or select), rather than dedicating a blocked thread to each queue.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_READINESSEVENT_HPP
+#define REISERRT_CORE_READINESSEVENT_HPP
+
+#include "ReiserRT_CoreExport.h"
+
+#include <atomic>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The ReadinessEvent Class
+        *
+        * This class provides a file descriptor that becomes readable when signaled and remains readable until cleared.
+        * Under Linux, it is an eventfd. Elsewhere, it is the read end of a pipe. Either way, it is non-blocking.
+        *
+        * A producer invokes signal after making data available. Only the first signal after a clear writes to the
+        * file descriptor. Others cost an atomic load. A consumer, woken by the file descriptor becoming readable,
+        * drains its data until none remains, invokes clear and then checks once more, as data made available
+        * before the clear did not signal. Data made available after the clear signals anew. Hence, no notification
+        * is lost, though a consumer may occasionally be woken to find nothing.
+        *
+        * A producer may set the flag and yet not have written when a consumer clears. Its write then lands after
+        * the clear, leaving the file descriptor readable with the flag unset. Clear therefore always drains the
+        * file descriptor, so that the consumer's next clear undoes any such late write.
+        *
+        * Unlike most classes within this library, ReadinessEvent does not employ the "pImple" idiom. Its fast path
+        * must be inlined. Only the system calls are made out of line.
+        */
+        class ReiserRT_Core_EXPORT ReadinessEvent
+        {
+        public:
+            /**
+            * @brief Default Constructor for ReadinessEvent
+            *
+            * This constructor creates the file descriptor, initially not readable.
+            *
+            * @throw Throws ReiserRT::Core::ReadinessEventError if the file descriptor cannot be created.
+            */
+            ReadinessEvent();
+
+            /**
+            * @brief Destructor for ReadinessEvent
+            *
+            * This destructor closes the file descriptor. It must have been removed from any epoll set beforehand.
+            */
+            ~ReadinessEvent();
+
+            /**
+            * @brief Copy Constructor for ReadinessEvent
+            *
+            * Copying ReadinessEvent is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a ReadinessEvent.
+            */
+            ReadinessEvent( const ReadinessEvent & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for ReadinessEvent
+            *
+            * Copy assignment of ReadinessEvent is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a ReadinessEvent.
+            */
+            ReadinessEvent & operator =( const ReadinessEvent & another ) = delete;
+
+            /**
+            * @brief Move Constructor for ReadinessEvent
+            *
+            * Moving ReadinessEvent is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a ReadinessEvent.
+            */
+            ReadinessEvent( ReadinessEvent && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for ReadinessEvent
+            *
+            * Move assignment of ReadinessEvent is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a ReadinessEvent.
+            */
+            ReadinessEvent & operator =( ReadinessEvent && another ) = delete;
+
+            /**
+            * @brief The Signal Operation
+            *
+            * This operation makes the file descriptor readable, if it is not already. It must be invoked after
+            * the data it announces has been made available.
+            */
+            inline void signal() noexcept
+            {
+                if ( !signaled.load( std::memory_order_seq_cst ) && !signaled.exchange( true, std::memory_order_seq_cst ) )
+                    write();
+            }
+
+            /**
+            * @brief The Clear Operation
+            *
+            * This operation makes the file descriptor no longer readable. The consumer must check for data
+            * once more afterwards (@see ReadinessEvent). The file descriptor is drained even if the flag was unset,
+            * as a signal racing a previous clear may have written late.
+            */
+            inline void clear() noexcept
+            {
+                signaled.store( false, std::memory_order_seq_cst );
+                read();
+            }
+
+            /**
+            * @brief The Get File Descriptor Operation
+            *
+            * @return Returns the file descriptor to be waited upon for readability (e.g., EPOLLIN).
+            */
+            [[nodiscard]] inline int getFd() const noexcept { return readFd; }
+
+        private:
+            /**
+            * @brief The Write Operation
+            *
+            * This operation writes to the file descriptor, making it readable.
+            */
+            void write() noexcept;
+
+            /**
+            * @brief The Read Operation
+            *
+            * This operation drains the file descriptor, making it no longer readable.
+            */
+            void read() noexcept;
+
+            /**
+            * @brief The Read File Descriptor
+            *
+            * This is the file descriptor waited upon. Under Linux, it is an eventfd.
+            */
+            int readFd{ -1 };
+
+            /**
+            * @brief The Write File Descriptor
+            *
+            * This is the file descriptor written by the signal operation. Under Linux, it is the same eventfd.
+            */
+            int writeFd{ -1 };
+
+            /**
+            * @brief The Signaled Flag
+            *
+            * This flag is set while the file descriptor is readable, or about to be.
+            */
+            std::atomic< bool > signaled{ false };
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_READINESSEVENT_HPP */
@@ -73,6 +73,41 @@ namespace ReiserRT {
             explicit RingBufferStateError( const char * msg ) : std::runtime_error{ msg } {}
         };
 
+        /**
+        * @brief RingBufferStorageError Exception Class
+        *
+        * This class is thrown by RingBufferStorage if the element storage for a ring buffer could not be
+        * obtained or configured as specified by RingBufferStorageOptions (e.g., no huge pages reserved,
+        * insufficient locked memory limits or no NUMA support).
+        */
+        class ReiserRT_Core_EXPORT RingBufferStorageError : public std::runtime_error
+        {
+        public:
+            /**
+            * @brief Constructor for RingBufferStorageError
+            *
+            * @param msg The message to be delivered by the base class' what member function.
+            */
+            explicit RingBufferStorageError( const char * msg ) : std::runtime_error{ msg } {}
+        };
+
+        /**
+        * @brief ReadinessEventError Exception Class
+        *
+        * This class is thrown by ReadinessEvent if its file descriptor could not be created
+        * (e.g., the process file descriptor limit has been reached).
+        */
+        class ReiserRT_Core_EXPORT ReadinessEventError : public std::runtime_error
+        {
+        public:
+            /**
+            * @brief Constructor for ReadinessEventError
+            *
+            * @param msg The message to be delivered by the base class' what member function.
+            */
+            explicit ReadinessEventError( const char * msg ) : std::runtime_error{ msg } {}
+        };
+
         /**
         * @brief SemaphoreAborted Exception Class
         *
@@ -0,0 +1,726 @@
+/**
+* @file RingBufferBroadcast.hpp
+* @brief The Specification file for RingBufferBroadcast
+*
+* This file came into existence to allow one producer thread to feed several consumer threads (e.g., a logger,
+* a recorder and a processor) the same element stream from a single ring buffer, rather than putting a copy of
+* every element into a RingBufferGuarded per consumer.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERBROADCAST_HPP
+#define REISERRT_CORE_RINGBUFFERBROADCAST_HPP
+
+#include "ReiserRT_CoreExceptions.hpp"
+#include "RingBufferSizing.hpp"
+#include "RingBufferSpan.hpp"
+
+#include <atomic>
+#include <optional>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief Implementation class for RingBufferBroadcast
+        *
+        * This template class provides a lock-free, circular buffer for exactly one producer thread and a fixed number
+        * of consumer threads, in the manner of the LMAX "Disruptor". Every consumer sees every element. Each consumer
+        * has its own cursor (a count of elements consumed) on its own cache line. The producer may not overwrite an
+        * element until the slowest consumer has consumed it. A consumer may declare dependencies on other consumers,
+        * in which case it may not consume an element until they all have. This forms a pipeline (e.g., a processor
+        * that only sees elements after the recorder has recorded them). It uses the same power of two sizing as
+        * RingBufferSimpleImple.
+        *
+        * @warning Only one thread may invoke put operations and only one thread may invoke get operations for any
+        * one consumer. Violating this requirement results in undefined behavior.
+        *
+        * @tparam ElementType The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float, void pointer,
+        * typed pointer or a small POD structure).
+        */
+        template< typename ElementType >
+        class RingBufferBroadcastImple
+        {
+        private:
+            // ElementType must be trivially copyable for rapid load and store operations, default constructible,
+            // non-constant as put requires a write, and no larger than a cache line.
+            static_assert( RingBufferElementTraits< ElementType >::isSupported,
+                    "RingBufferBroadcastImple<ElementType> must specify a non-const, trivially copyable type no larger than a cache line!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< ElementType >::ParamType;
+
+            /**
+            * @brief Ring Buffer Sizing Type
+            *
+            * This type provides the power of two sizing logic shared by all RingBuffer implementations.
+            */
+            using Sizing = RingBufferSizing<>;
+
+            /**
+            * @brief Ring Buffer 32bit Counter Type
+            *
+            * This counter type is used to track get and put indices.
+            */
+            using CounterType = Sizing::CounterType;
+
+            /**
+            * @brief Atomic Counter Type
+            *
+            * The put counter and consumer cursors are shared between threads and must be atomic.
+            */
+            using AtomicCounterType = std::atomic< CounterType >;
+
+            // Our atomic counter type must be lock-free or there is no point to this class.
+            static_assert( AtomicCounterType::is_always_lock_free,
+                    "RingBufferBroadcastImple requires a lock-free atomic counter type!" );
+
+            /**
+            * @brief Dependency Mask Type
+            *
+            * A bit mask of the consumers that a consumer depends upon. Bit j set indicates dependence on consumer j.
+            */
+            using DependencyMaskType = uint64_t;
+
+            /**
+            * @brief The Consumer Cursor Structure
+            *
+            * Each consumer's cursor occupies its own cache line, along with the consumer's dependencies and
+            * a cached copy of the limit it may consume up to. Only the cursor itself is read by other threads.
+            */
+            struct alignas( ringBufferCacheLineSize ) Cursor
+            {
+                AtomicCounterType count{ 0 };           //!< The number of elements consumed.
+                CounterType cachedLimit{ 0 };           //!< The last observed limit the consumer may consume up to.
+                DependencyMaskType dependencies{ 0 };   //!< The consumers that must consume an element first.
+            };
+
+            /**
+            * @brief Friend Declaration
+            *
+            * Template class RingBufferBroadcast is a friend and only it can invoked our member operations.
+            */
+            template< typename ST > friend class RingBufferBroadcast;
+
+        public:
+            /**
+            * @brief Maximum Number of Consumers
+            *
+            * Dependencies are tracked with a bit mask. Hence, we are limited to as many consumers as it has bits.
+            */
+            static constexpr size_t maxConsumers = sizeof( DependencyMaskType ) * 8;
+
+        protected:
+            /**
+            * @brief Qualified Constructor for RingBufferBroadcastImple
+            *
+            * This qualified constructor instantiates a RingBufferBroadcastImple by first scrutinizing the
+            * requestedNumElements argument in the same manner as RingBufferSimpleImple. Once the actual number of
+            * elements to be allocated is determined, a buffer for elements and a cursor for each consumer are allocated.
+            *
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            * @param theNumConsumers The number of consumers. There must be at least one and no more than maxConsumers.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if theNumConsumers is out of range.
+            */
+            RingBufferBroadcastImple( size_t requestedNumElements, size_t theNumConsumers )
+                : numBits{ Sizing::numBitsForNE( requestedNumElements ) }
+                , numElementsMask{ Sizing::maskForNB( numBits ) }
+                , numElements{ numElementsMask + 1 }
+                , numConsumers{ validateNumConsumers( theNumConsumers ) }
+                , pElementBuf{ new ElementType[ numElements ] }
+                , pCursors{ new Cursor[ numConsumers ] }
+            {
+            }
+
+            /**
+            * @brief Destructor for RingBufferBroadcastImple
+            *
+            * The destructor returns the ring buffer element block and cursors to the standard heap.
+            */
+            ~RingBufferBroadcastImple()
+            {
+                delete[] pCursors;
+                delete[] pElementBuf;
+            }
+
+            /**
+            * @brief Add a Dependency Between Consumers
+            *
+            * This operation declares that a consumer may not consume an element until an upstream consumer has.
+            * Dependencies must be declared before any put or get operation is invoked.
+            *
+            * @param consumer The index of the dependent consumer.
+            * @param upstream The index of the consumer depended upon.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if either index is out of range or if the dependency
+            * would form a cycle (including a consumer depending on itself).
+            */
+            void addDependency( size_t consumer, size_t upstream )
+            {
+                if ( consumer >= numConsumers || upstream >= numConsumers )
+                {
+                    throw RingBufferStateError{ "RingBufferBroadcastImple::addDependency consumer index out of range!" };
+                }
+                if ( consumer == upstream || dependsOn( upstream, consumer ) )
+                {
+                    throw RingBufferStateError{ "RingBufferBroadcastImple::addDependency would form a cycle!" };
+                }
+                pCursors[ consumer ].dependencies |= DependencyMaskType( 1 ) << upstream;
+            }
+
+            /**
+            * @brief Try to Put an Element Into The RingBufferBroadcastImple
+            *
+            * This operation attempts to put an element and publish the new putCount to all consumers.
+            * It may only be invoked by the one producer thread. The producer is gated by the slowest consumer.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the value was put and false if the slowest consumer has not made room.
+            */
+            bool tryPut( ParamType val ) noexcept
+            {
+                const CounterType currentPut = putCount.load( std::memory_order_relaxed );
+
+                // If we appear full relative to our cached minimum cursor, refresh it and check again.
+                if ( CounterType( currentPut - cachedMinCursor ) == numElements )
+                {
+                    cachedMinCursor = minCursor( currentPut );
+                    if ( CounterType( currentPut - cachedMinCursor ) == numElements ) return false;
+                }
+
+                pElementBuf[ currentPut & numElementsMask ] = val;
+                putCount.store( currentPut + 1, std::memory_order_release );
+                return true;
+            }
+
+            /**
+            * @brief Put an Element Into The RingBufferBroadcastImple
+            *
+            * This operation puts an element. It may only be invoked by the one producer thread.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if the slowest consumer has not made room.
+            *
+            * @param val The value to put.
+            */
+            void put( ParamType val )
+            {
+                if ( !tryPut( val ) )
+                {
+                    throw RingBufferOverflow{ "RingBufferBroadcastImple::put() would result in overflow!" };
+                }
+            }
+
+            /**
+            * @brief Try to Get an Element From The RingBufferBroadcastImple
+            *
+            * This operation attempts to get the next element for a consumer and advance its cursor.
+            * It may only be invoked by the one thread servicing that consumer.
+            *
+            * @param consumer The index of the consumer. This is not validated.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if nothing is available
+            * to this consumer.
+            */
+            std::optional< ElementType > tryGet( size_t consumer ) noexcept
+            {
+                Cursor & cursor = pCursors[ consumer ];
+                const CounterType current = cursor.count.load( std::memory_order_relaxed );
+                if ( current == cursor.cachedLimit )
+                {
+                    cursor.cachedLimit = limitFor( cursor );
+                    if ( current == cursor.cachedLimit ) return std::nullopt;
+                }
+
+                ElementType val = pElementBuf[ current & numElementsMask ];
+                cursor.count.store( current + 1, std::memory_order_release );
+                return val;
+            }
+
+            /**
+            * @brief Get an Element From The RingBufferBroadcastImple
+            *
+            * This operation gets the next element for a consumer and advances its cursor.
+            * It may only be invoked by the one thread servicing that consumer.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if nothing is available to this consumer.
+            *
+            * @param consumer The index of the consumer. This is not validated.
+            *
+            * @return Returns an element from the RingBufferBroadcastImple.
+            */
+            ElementType get( size_t consumer )
+            {
+                auto val = tryGet( consumer );
+                if ( !val )
+                {
+                    throw RingBufferUnderflow{ "RingBufferBroadcastImple::get() would result in underflow!" };
+                }
+                return *val;
+            }
+
+            /**
+            * @brief Peek at Contiguous Elements for Get In Place
+            *
+            * This operation is the first phase of a zero-copy get for a consumer. It returns a span of up to n
+            * contiguous elements available to the consumer. The span is limited by the elements available and by the
+            * point where the element buffer wraps around. Elements may be modified in place. Such modifications are
+            * visible to dependent consumers once released. Nothing is consumed until the release operation is invoked.
+            *
+            * @param consumer The index of the consumer. This is not validated.
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous elements.
+            */
+            RingBufferSpan< ElementType > peekSpan( size_t consumer, size_t n ) noexcept
+            {
+                Cursor & cursor = pCursors[ consumer ];
+                const CounterType current = cursor.count.load( std::memory_order_relaxed );
+                if ( CounterType( cursor.cachedLimit - current ) < n ) cursor.cachedLimit = limitFor( cursor );
+
+                const CounterType first = current & numElementsMask;
+                const size_t available = CounterType( cursor.cachedLimit - current );
+                const size_t contiguous = numElements - first;
+                if ( n > available ) n = available;
+                if ( n > contiguous ) n = contiguous;
+                return { pElementBuf + first, n };
+            }
+
+            /**
+            * @brief Release Elements Previously Peeked
+            *
+            * This operation is the second phase of a zero-copy get. It advances the consumer's cursor by n.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available.
+            *
+            * @param consumer The index of the consumer. This is not validated.
+            * @param n The number of elements to consume. This should not exceed the size of the peeked span.
+            */
+            void release( size_t consumer, size_t n )
+            {
+                Cursor & cursor = pCursors[ consumer ];
+                const CounterType current = cursor.count.load( std::memory_order_relaxed );
+                if ( n > CounterType( cursor.cachedLimit - current ) )
+                {
+                    throw RingBufferUnderflow{ "RingBufferBroadcastImple::release(n) would result in underflow!" };
+                }
+                cursor.count.store( current + CounterType( n ), std::memory_order_release );
+            }
+
+            /**
+            * @brief Get the Available Count Operation
+            *
+            * This operation returns a snapshot of the number of elements available to a consumer.
+            *
+            * @param consumer The index of the consumer. This is not validated.
+            *
+            * @return Returns the number of elements available to the consumer.
+            */
+            [[nodiscard]] size_t getAvailableCount( size_t consumer ) const noexcept
+            {
+                const Cursor & cursor = pCursors[ consumer ];
+                return CounterType( limitFor( cursor ) - cursor.count.load( std::memory_order_relaxed ) );
+            }
+
+            /**
+            * @brief Get the Number Of Bits Operation
+            *
+            * @return Returns the number of bits used to mask a counter into an index.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return numBits; }
+
+            /**
+            * @brief Get the Number Of Elements Operation
+            *
+            * @return Returns the number of elements that the ring buffer holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return numElements; }
+
+            /**
+            * @brief Get the Mask Operation
+            *
+            * @return Returns the mask used to filter a counter to an index.
+            */
+            [[nodiscard]] inline size_t getMask() const noexcept { return numElementsMask; }
+
+            /**
+            * @brief Get the Number Of Consumers Operation
+            *
+            * @return Returns the number of consumers.
+            */
+            [[nodiscard]] inline size_t getNumConsumers() const noexcept { return numConsumers; }
+
+        private:
+            /**
+            * @brief Validate the Number of Consumers
+            *
+            * @param n The number of consumers requested.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if n is zero or exceeds maxConsumers.
+            *
+            * @return Returns n, if valid.
+            */
+            static size_t validateNumConsumers( size_t n )
+            {
+                if ( 0 == n || n > maxConsumers )
+                {
+                    throw RingBufferStateError{ "RingBufferBroadcastImple: Number of consumers out of range!" };
+                }
+                return n;
+            }
+
+            /**
+            * @brief Transitive Dependency Test
+            *
+            * @param consumer The index of a consumer.
+            * @param upstream The index of another consumer.
+            *
+            * @return Returns true if consumer depends, directly or indirectly, upon upstream.
+            */
+            bool dependsOn( size_t consumer, size_t upstream ) const noexcept
+            {
+                const DependencyMaskType deps = pCursors[ consumer ].dependencies;
+                for ( size_t j = 0; j != numConsumers; ++j )
+                {
+                    if ( ( deps >> j ) & 1 )
+                    {
+                        if ( j == upstream || dependsOn( j, upstream ) ) return true;
+                    }
+                }
+                return false;
+            }
+
+            /**
+            * @brief The Minimum Cursor Operation
+            *
+            * This operation determines the cursor of the slowest consumer, relative to the putCount so that
+            * roll-over is handled correctly. It is invoked by the producer.
+            *
+            * @param currentPut The current putCount.
+            *
+            * @return Returns the cursor furthest behind the putCount.
+            */
+            CounterType minCursor( CounterType currentPut ) const noexcept
+            {
+                CounterType minCount = currentPut;
+                for ( size_t i = 0; i != numConsumers; ++i )
+                {
+                    const CounterType c = pCursors[ i ].count.load( std::memory_order_acquire );
+                    if ( CounterType( currentPut - c ) > CounterType( currentPut - minCount ) ) minCount = c;
+                }
+                return minCount;
+            }
+
+            /**
+            * @brief The Limit For Operation
+            *
+            * This operation determines how far a consumer may consume. That is the putCount or, if the consumer has
+            * dependencies, the cursor of the slowest consumer it depends upon.
+            *
+            * @param cursor The consumer's cursor.
+            *
+            * @return Returns the count up to which the consumer may consume.
+            */
+            CounterType limitFor( const Cursor & cursor ) const noexcept
+            {
+                const CounterType current = cursor.count.load( std::memory_order_relaxed );
+                CounterType limit = putCount.load( std::memory_order_acquire );
+                for ( size_t j = 0; j != numConsumers; ++j )
+                {
+                    if ( ( cursor.dependencies >> j ) & 1 )
+                    {
+                        const CounterType c = pCursors[ j ].count.load( std::memory_order_acquire );
+                        if ( CounterType( c - current ) < CounterType( limit - current ) ) limit = c;
+                    }
+                }
+                return limit;
+            }
+
+            /**
+            * @brief The Put Count
+            *
+            * This attribute counts elements put. It is written by the producer and read by all consumers.
+            * It starts a cache line of its own.
+            */
+            alignas( ringBufferCacheLineSize ) AtomicCounterType putCount{ 0 };
+
+            /**
+            * @brief The Cached Minimum Cursor
+            *
+            * This attribute is the producer's cached copy of the slowest consumer's cursor. It is only refreshed
+            * when the producer appears to be full.
+            */
+            CounterType cachedMinCursor{ 0 };
+
+            /**
+            * @brief The Number of Bits
+            *
+            * The number of bits required for a mask to determine an index into an N element buffer.
+            * The constant attributes start a cache line of their own which is only ever read after construction.
+            */
+            alignas( ringBufferCacheLineSize ) const CounterType numBits;
+
+            /**
+            * @brief The Number of Elements Mask
+            *
+            * The mask to determine an index into an N element buffer.
+            */
+            const CounterType numElementsMask;
+
+            /**
+            * @brief The Number of Elements.
+            *
+            * The number of elements that are available for put from an empty state.
+            */
+            const CounterType numElements;
+
+            /**
+            * @brief The Number of Consumers.
+            *
+            * The number of consumers, each of which has a cursor.
+            */
+            const size_t numConsumers;
+
+            /**
+            * @brief The Element Buffer.
+            *
+            * This is the buffer space in where elements put are stored until consumed by all consumers.
+            */
+            ElementType * const pElementBuf;
+
+            /**
+            * @brief The Cursors.
+            *
+            * This is an array of cursors, one per consumer, each on its own cache line.
+            */
+            Cursor * const pCursors;
+        };
+
+        /**
+        * @brief RingBufferBroadcast Class
+        *
+        * This template class provides a lock-free, single producer ring buffer which broadcasts every element to
+        * a fixed number of consumers, identified by index. One copy of each element feeds all consumers. The producer
+        * is gated by the slowest consumer. Consumers may be arranged into a pipeline by declaring dependencies
+        * upon each other. Neither producer nor consumers ever block. Put operations report (tryPut) or throw (put)
+        * when full. Get operations report (tryGet) or throw (get) when nothing is available. Typically, pointers
+        * to pool allocated objects (@see ObjectPool) are broadcast. Ownership of such objects remains with the
+        * producer, which may only reclaim an object once all consumers have consumed it.
+        *
+        * @warning Only one thread may invoke put operations and only one thread may invoke get operations for any
+        * one consumer. Violating this requirement results in undefined behavior.
+        *
+        * @tparam T The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line.
+        */
+        template< typename T >
+        class RingBufferBroadcast
+        {
+        private:
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
+
+        public:
+            /**
+            * @brief Maximum Number of Consumers
+            *
+            * This is the maximum number of consumers supported.
+            */
+            static constexpr size_t maxConsumers = RingBufferBroadcastImple< T >::maxConsumers;
+
+            /**
+            * @brief Qualified Constructor for RingBufferBroadcast
+            *
+            * This is our qualified constructor for RingBufferBroadcast. It instantiates the implementation,
+            * passing it the requestedNumElements and numConsumers arguments.
+            *
+            * @param requestedNumElements The requested number of elements for RingBufferBroadcast.
+            * @param numConsumers The number of consumers. There must be at least one and no more than maxConsumers.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if numConsumers is out of range.
+            */
+            RingBufferBroadcast( size_t requestedNumElements, size_t numConsumers )
+                : imple{ requestedNumElements, numConsumers }
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferBroadcast
+            *
+            * Copying RingBufferBroadcast is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferBroadcast of the same templated type.
+            */
+            RingBufferBroadcast( const RingBufferBroadcast & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferBroadcast
+            *
+            * Copy assignment of RingBufferBroadcast is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferBroadcast of the same templated type.
+            */
+            RingBufferBroadcast & operator =( const RingBufferBroadcast & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferBroadcast
+            *
+            * Moving RingBufferBroadcast is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferBroadcast of the same templated type.
+            */
+            RingBufferBroadcast( RingBufferBroadcast && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferBroadcast
+            *
+            * Move assignment of RingBufferBroadcast is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferBroadcast of the same templated type.
+            */
+            RingBufferBroadcast & operator =( RingBufferBroadcast && another ) = delete;
+
+            /**
+            * @brief The Add Dependency Operation
+            *
+            * This operation declares that a consumer may not consume an element until an upstream consumer has.
+            * Dependencies must be declared before any put or get operation is invoked.
+            *
+            * @param consumer The index of the dependent consumer.
+            * @param upstream The index of the consumer depended upon.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if either index is out of range or the dependency
+            * would form a cycle.
+            */
+            inline void addDependency( size_t consumer, size_t upstream ) { imple.addDependency( consumer, upstream ); }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation attempts to put an element of type T without throwing. Producer thread only.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the element was put and false if the slowest consumer has not made room.
+            */
+            inline bool tryPut( ParamType val ) noexcept { return imple.tryPut( val ); }
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation puts an element of type T. Producer thread only.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if the slowest consumer has not made room.
+            *
+            * @param val The value to put.
+            */
+            inline void put( ParamType val ) { imple.put( val ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation attempts to get the next element of type T for a consumer without throwing.
+            *
+            * @param consumer The index of the consumer.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if nothing is available.
+            */
+            inline std::optional< T > tryGet( size_t consumer ) noexcept { return imple.tryGet( consumer ); }
+
+            /**
+            * @brief The Get Operation
+            *
+            * This operation gets the next element of type T for a consumer.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if nothing is available.
+            *
+            * @param consumer The index of the consumer.
+            *
+            * @return Returns an element of type T.
+            */
+            inline T get( size_t consumer ) { return imple.get( consumer ); }
+
+            /**
+            * @brief The Peek Span Operation
+            *
+            * This operation returns a span of up to n contiguous elements available to a consumer.
+            * @see RingBufferBroadcastImple::peekSpan.
+            *
+            * @param consumer The index of the consumer.
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous elements.
+            */
+            inline RingBufferSpan< T > peekSpan( size_t consumer, size_t n ) noexcept { return imple.peekSpan( consumer, n ); }
+
+            /**
+            * @brief The Release Operation
+            *
+            * This operation consumes n elements previously peeked by a consumer.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available.
+            *
+            * @param consumer The index of the consumer.
+            * @param n The number of elements to consume.
+            */
+            inline void release( size_t consumer, size_t n ) { imple.release( consumer, n ); }
+
+            /**
+            * @brief The Get Available Count Operation
+            *
+            * @param consumer The index of the consumer.
+            *
+            * @return Returns a snapshot of the number of elements available to the consumer.
+            */
+            [[nodiscard]] inline size_t getAvailableCount( size_t consumer ) const noexcept { return imple.getAvailableCount( consumer ); }
+
+            /**
+            * @brief The Get Number of Bits Operation
+            *
+            * @return Returns the number of bits used to mask a counter into an index.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return imple.getNumBits(); }
+
+            /**
+            * @brief The Get Size Operation
+            *
+            * @return Returns the number of elements the ring buffer holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return imple.getSize(); }
+
+            /**
+            * @brief The Get Mask Operation
+            *
+            * @return Returns the mask used to filter a counter to an index.
+            */
+            [[nodiscard]] inline size_t getMask() const noexcept { return imple.getMask(); }
+
+            /**
+            * @brief The Get Number of Consumers Operation
+            *
+            * @return Returns the number of consumers.
+            */
+            [[nodiscard]] inline size_t getNumConsumers() const noexcept { return imple.getNumConsumers(); }
+
+        private:
+            /**
+            * @brief Our Implementation Instance
+            *
+            * This attribute is our implementation.
+            */
+            RingBufferBroadcastImple< T > imple;
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERBROADCAST_HPP */
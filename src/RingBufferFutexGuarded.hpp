@@ -0,0 +1,292 @@
+/**
+* @file RingBufferFutexGuarded.hpp
+* @brief The Specification file for RingBufferFutexGuarded
+*
+* This file came into existence because RingBufferGuarded locks a Mutex, and may signal a condition variable,
+* on every get and put operation, whether anyone is waiting or not. That overhead dominated small message
+* throughput. RingBufferFutexGuarded only enters the kernel when a thread actually has to wait.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERFUTEXGUARDED_HPP
+#define REISERRT_CORE_RINGBUFFERFUTEXGUARDED_HPP
+
+#include "ReiserRT_CoreExceptions.hpp"
+#include "RingBufferSPSC.hpp"
+#include "RingBufferMPMC.hpp"
+#include "RingBufferPolicies.hpp"
+#include "FutexEvent.hpp"
+
+#include <atomic>
+#include <optional>
+#include <type_traits>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief RingBufferFutexGuarded Class
+        *
+        * This template class provides a thread safe, blocking ring buffer for any number of producer and consumer
+        * threads. Elements reside in a lock-free RingBufferMPMC or, when constructed for a SingleProducer and a
+        * SingleConsumer, the cheaper RingBufferSPSC. This selection is made at compile time. Two FutexEvent
+        * instances, "not empty" and "not full", provide blocking. The get operation blocks while empty and the put operation blocks while full.
+        * When no thread is blocked, a get or put is a RingBufferMPMC operation followed by a fence and a load of
+        * the opposing event's futex word. No lock is taken and no system call is made. Only when a thread has
+        * prepared to block does the opposing operation issue a futex wake, and then only once.
+        *
+        * @tparam T The ring buffer element type, including typed pointers (@see RingBufferMPMC).
+        * @tparam ProducerPolicy SingleProducer or MultiProducer (the default).
+        * @tparam ConsumerPolicy SingleConsumer or MultiConsumer (the default).
+        * @note Must be a trivially copyable type no larger than a cache line.
+        * @warning Violating a SingleProducer or SingleConsumer policy results in undefined behavior.
+        */
+        template< typename T, typename ProducerPolicy = MultiProducer, typename ConsumerPolicy = MultiConsumer >
+        class RingBufferFutexGuarded
+        {
+        private:
+            static_assert( isProducerPolicy< ProducerPolicy >,
+                    "RingBufferFutexGuarded ProducerPolicy must be SingleProducer or MultiProducer!" );
+            static_assert( isConsumerPolicy< ConsumerPolicy >,
+                    "RingBufferFutexGuarded ConsumerPolicy must be SingleConsumer or MultiConsumer!" );
+
+            /**
+            * @brief The Ring Buffer Type
+            *
+            * A single producer and a single consumer are served by RingBufferSPSC. Any other combination requires
+            * RingBufferMPMC, the only lock-free ring buffer here that tolerates concurrent producers or consumers.
+            */
+            using RingBufferType = std::conditional_t<
+                    std::is_same_v< ProducerPolicy, SingleProducer > && std::is_same_v< ConsumerPolicy, SingleConsumer >,
+                    RingBufferSPSC< T >, RingBufferMPMC< T > >;
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
+
+        public:
+            /**
+            * @brief Qualified Constructor for RingBufferFutexGuarded
+            *
+            * @param requestedNumElements The requested number of elements. The actual size will be the next power of two.
+            * @param options The storage options (@see RingBufferStorageOptions).
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if storage cannot be obtained as specified.
+            */
+            explicit RingBufferFutexGuarded( size_t requestedNumElements,
+                                             const RingBufferStorageOptions & options = RingBufferStorageOptions{} )
+                : ringBuffer{ requestedNumElements, options }
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferFutexGuarded
+            *
+            * Copying RingBufferFutexGuarded is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferFutexGuarded of the same templated type.
+            */
+            RingBufferFutexGuarded( const RingBufferFutexGuarded & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferFutexGuarded
+            *
+            * Copy assignment of RingBufferFutexGuarded is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferFutexGuarded of the same templated type.
+            */
+            RingBufferFutexGuarded & operator =( const RingBufferFutexGuarded & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferFutexGuarded
+            *
+            * Moving RingBufferFutexGuarded is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferFutexGuarded of the same templated type.
+            */
+            RingBufferFutexGuarded( RingBufferFutexGuarded && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferFutexGuarded
+            *
+            * Move assignment of RingBufferFutexGuarded is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferFutexGuarded of the same templated type.
+            */
+            RingBufferFutexGuarded & operator =( RingBufferFutexGuarded && another ) = delete;
+
+            /**
+            * @brief The Abort Operation
+            *
+            * This operation wakes all blocked threads and causes all subsequent get operations to throw and put
+            * operations to return without effect (tryPut returning false). Once aborted, there is no recovery.
+            */
+            void abort() noexcept
+            {
+                aborted.store( true, std::memory_order_seq_cst );
+                notEmpty.notify();
+                notFull.notify();
+            }
+
+            /**
+            * @brief The Get Operation
+            *
+            * This operation gets an element, blocking while the ring buffer is empty.
+            *
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if aborted, as RingBufferGuarded waiters do.
+            *
+            * @return Returns the element retrieved.
+            */
+            T get()
+            {
+                for (;;)
+                {
+                    if ( aborted.load( std::memory_order_relaxed ) ) throwAborted();
+
+                    // Fast path. Otherwise, register as a waiter and re-check before sleeping.
+                    // A put between the two is not lost.
+                    auto val = ringBuffer.tryGet();
+                    if ( !val )
+                    {
+                        const auto key = notEmpty.prepareWait();
+                        val = ringBuffer.tryGet();
+                        if ( !val && !aborted.load( std::memory_order_seq_cst ) )
+                        {
+                            notEmpty.commitWait( key );
+                            continue;
+                        }
+                        notEmpty.cancelWait();
+                        if ( !val ) throwAborted();
+                    }
+
+                    // Wake a producer blocked on full, if any.
+                    notFull.notify();
+                    return *val;
+                }
+            }
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation puts an element, blocking while the ring buffer is full. If aborted, it returns without
+            * effect, getting out of the way as RingBufferGuarded does.
+            *
+            * @param val The value to put.
+            */
+            void put( ParamType val )
+            {
+                for (;;)
+                {
+                    if ( aborted.load( std::memory_order_relaxed ) ) return;
+
+                    // Fast path. Otherwise, register as a waiter and re-check before sleeping.
+                    // A get between the two is not lost.
+                    if ( !ringBuffer.tryPut( val ) )
+                    {
+                        const auto key = notFull.prepareWait();
+                        const bool wasPut = ringBuffer.tryPut( val );
+                        if ( !wasPut && !aborted.load( std::memory_order_seq_cst ) )
+                        {
+                            notFull.commitWait( key );
+                            continue;
+                        }
+                        notFull.cancelWait();
+                        if ( !wasPut ) return;
+                    }
+
+                    // Wake a consumer blocked on empty, if any.
+                    notEmpty.notify();
+                    return;
+                }
+            }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation attempts to get an element without blocking.
+            *
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if aborted.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if empty.
+            */
+            std::optional< T > tryGet()
+            {
+                if ( aborted.load( std::memory_order_relaxed ) ) throwAborted();
+                auto val = ringBuffer.tryGet();
+                if ( val ) notFull.notify();
+                return val;
+            }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation attempts to put an element without blocking. If aborted, it returns false without effect.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the element was put and false if full or aborted.
+            */
+            bool tryPut( ParamType val ) noexcept
+            {
+                if ( aborted.load( std::memory_order_relaxed ) ) return false;
+                if ( !ringBuffer.tryPut( val ) ) return false;
+                notEmpty.notify();
+                return true;
+            }
+
+            /**
+            * @brief The Get Size Operation
+            *
+            * @return Returns the number of elements the ring buffer holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return ringBuffer.getSize(); }
+
+        private:
+            /**
+            * @brief The Throw Aborted Operation
+            *
+            * @throw Throws ReiserRT::Core::SemaphoreAborted.
+            */
+            [[noreturn]] static void throwAborted()
+            {
+                throw SemaphoreAborted{ "RingBufferFutexGuarded::get() aborted!" };
+            }
+
+            /**
+            * @brief Our Ring Buffer
+            *
+            * This is the lock-free ring buffer holding our elements.
+            */
+            RingBufferType ringBuffer;
+
+            /**
+            * @brief The Not Empty Event
+            *
+            * Consumers wait upon this event while empty. Producers notify it after a put.
+            */
+            FutexEvent notEmpty{};
+
+            /**
+            * @brief The Not Full Event
+            *
+            * Producers wait upon this event while full. Consumers notify it after a get.
+            */
+            FutexEvent notFull{};
+
+            /**
+            * @brief The Aborted Flag
+            *
+            * This flag is set, once and for all, by the abort operation.
+            */
+            std::atomic< bool > aborted{ false };
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERFUTEXGUARDED_HPP */
@@ -9,9 +9,16 @@
 #define REISERRT_CORE_RINGBUFFERGUARDED_HPP
 
 #include "RingBufferSimple.hpp"
+#include "RingBufferPolicies.hpp"
 #include "Semaphore.hpp"
+#include "ReadinessEvent.hpp"
 
 #include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
 
 namespace ReiserRT
 {
@@ -24,17 +31,72 @@ namespace ReiserRT
         * It employs a counted semaphore object which will block get operations on an empty ring buffer.
         * It will also block  put operations on a full ring buffer.
         *
+        * By default, any number of threads may put and get. Every access to the base ring buffer is then made within
+        * the context of our semaphore's internal lock. Where only one thread puts (SingleProducer), that thread
+        * writes its value outside of the lock and the semaphore merely publishes it. Where only one thread gets
+        * (SingleConsumer), that thread reads its value outside of the lock once the semaphore has been taken.
+        * Either way, the semaphore's lock is held only for the count. To make this safe, each side advances only its
+        * own base counter and the base is sized with one spare element per single side.
+        *
         * @tparam T The ring buffer element type.
-        * @note Must be a scalar type (e.g., char, int, float or void pointer).
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float, void pointer
+        * or a small POD structure).
+        * @tparam ProducerPolicy SingleProducer or MultiProducer (the default).
+        * @tparam ConsumerPolicy SingleConsumer or MultiConsumer (the default).
+        * @warning Specifying a single policy where more than one thread puts (or gets) corrupts the ring buffer.
         */
-        template< typename T >
+        template< typename T, typename ProducerPolicy = MultiProducer, typename ConsumerPolicy = MultiConsumer >
         class RingBufferGuardedBase : public RingBufferSimple< T >
         {
         private:
-            // T must be a valid scalar type for rapid load and store operations. Non-scalar types are supportable
-            // through a type pointer. See class ObjectPool within this namespace for such a use case.
-            static_assert( std::is_scalar< T >::value,
-                    "RingBufferGuardedBase< T > must specify a scalar type (which includes pointer types)!" );
+            // T must be trivially copyable and no larger than a cache line for rapid load and store operations.
+            // Larger types are supportable through a type pointer. See class ObjectPool within this namespace for such
+            // a use case.
+            static_assert( RingBufferElementTraits< T >::isSupported,
+                    "RingBufferGuardedBase< T > must specify a trivially copyable type no larger than a cache line!" );
+
+            static_assert( isProducerPolicy< ProducerPolicy >,
+                    "RingBufferGuardedBase ProducerPolicy must be SingleProducer or MultiProducer!" );
+            static_assert( isConsumerPolicy< ConsumerPolicy >,
+                    "RingBufferGuardedBase ConsumerPolicy must be SingleConsumer or MultiConsumer!" );
+
+            /**
+            * @brief Single Producer Indication
+            *
+            * True if only one thread puts. Its values are written outside of our semaphore's internal lock.
+            */
+            static constexpr bool singleProducer = std::is_same_v< ProducerPolicy, SingleProducer >;
+
+            /**
+            * @brief Single Consumer Indication
+            *
+            * True if only one thread gets. Its values are read outside of our semaphore's internal lock.
+            */
+            static constexpr bool singleConsumer = std::is_same_v< ConsumerPolicy, SingleConsumer >;
+
+            /**
+            * @brief Checked Access Indication
+            *
+            * True if both sides are multiple. All access to the base is then made within our semaphore's internal
+            * lock and checked by the base, as it always has been. Otherwise, one side accesses the base outside of
+            * the lock, so each side may only read and advance its own base counter, unchecked.
+            */
+            static constexpr bool checkedAccess = !singleProducer && !singleConsumer;
+
+            /**
+            * @brief Spare Element Count
+            *
+            * A single producer writes its value before waiting for room and a single consumer reads its value after
+            * the semaphore no longer counts it. Each may therefore occupy one element beyond our capacity.
+            */
+            static constexpr size_t spareElements = size_t( singleProducer ) + size_t( singleConsumer );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
 
             /**
             * @brief Alias Type to RingBufferBase< T >
@@ -64,6 +126,32 @@ namespace ReiserRT
             */
             using AtomicStateType = std::atomic< State >;
 
+        public:
+            /**
+            * @brief The Time Point Type
+            *
+            * Deadlines for timed operations are specified upon the steady clock (CLOCK_MONOTONIC under Linux).
+            */
+            using TimePointType = Semaphore::TimePointType;
+
+        private:
+
+            /**
+            * @brief Hide the Zero-Copy and Inspection Operations of our Base
+            *
+            * The reserve/commit and peekSpan/release operations of RingBufferSimple, as well as its peek,
+            * getAvailableCount and begin/end iteration operations, are not guarded by our semaphore.
+            * These declarations make them inaccessible to our clients.
+            */
+            using Base::reserve;
+            using Base::commit;
+            using Base::peekSpan;
+            using Base::release;
+            using Base::peek;
+            using Base::getAvailableCount;
+            using Base::begin;
+            using Base::end;
+
         public:
             /**
             * @brief Qualified Constructor for RingBufferGuardedBase
@@ -77,12 +165,19 @@ namespace ReiserRT
             * @param requestedNumElements The requested number of elements. This is always rounded up to the next power of two for
             * the ring buffer itself, but not for the semaphore available count.
             * @param willPrime If non-zero, the ring buffer must be subsequently primed by invoking the prime operation.
+            * @param theWaitPolicy The policy followed by get and put operations that must wait (@see WaitPolicy).
+            * A spinning policy suits latency critical queues serviced on isolated cores. The default blocks at once.
+            * @param enableReadinessFd If true, a readiness file descriptor is provided (@see getReadinessFd).
             * @warning Failure to prime the instance will result in exceptions being thrown via get and put operations.
+            * @throw Throws ReiserRT::Core::ReadinessEventError if the readiness file descriptor cannot be created.
             */
-            explicit RingBufferGuardedBase( size_t theRequestedNumElements, bool willPrime = false )
-                : Base{ theRequestedNumElements }
-                , semaphore{ willPrime ? theRequestedNumElements : 0, theRequestedNumElements }
+            explicit RingBufferGuardedBase( size_t theRequestedNumElements, bool willPrime = false,
+                                            const WaitPolicy & theWaitPolicy = WaitPolicy{},
+                                            bool enableReadinessFd = false )
+                : Base{ theRequestedNumElements + spareElements }
+                , semaphore{ willPrime ? theRequestedNumElements : 0, theRequestedNumElements, theWaitPolicy }
                 , state{ willPrime ? State::NeedsPriming : State::Ready }
+                , pReadiness{ enableReadinessFd ? new ReadinessEvent{} : nullptr }
             {
             }
 
@@ -134,15 +229,9 @@ namespace ReiserRT
                     throw RingBufferStateError{ "RingBufferGuarded::get invoked while not in the Ready state!" };
                 }
 
-                // Instantiate return variable and setup a lambda to be invoked in the context of the semaphore's internal lock.
                 // We are 100% confident that this will not throw an underflow exception because the ring buffer available elements to "get"
                 // are at least that of the semaphore's available count and it will block if this is not the case.
-                T retVal;
-                auto getFunk = [ this, &retVal ]() { retVal = this->Base::get(); };
-
-                // Invoke semaphore take passing our lambda and return the result.
-                semaphore.take(std::ref(getFunk));
-                return retVal;
+                return *getGuarded( [ this ]( auto & getFunk ) { semaphore.take( std::ref( getFunk ) ); return true; } );
             }
 
             /**
@@ -168,7 +257,7 @@ namespace ReiserRT
             *
             * @param p val A value to be put into the ring buffer implementation.
             */
-            inline void put( T val )
+            inline void put( ParamType val )
             {
                 // If we are in the terminal state, we will just get out of the way
                 if ( state == State::Terminal ) return;
@@ -179,11 +268,326 @@ namespace ReiserRT
                     throw RingBufferStateError{ "RingBufferGuarded::put invoked while not in the Ready state!" };
                 }
 
-                // Set up a lambda to be invoked in the context of the semaphore's internal lock.
                 // There is no guarding of overflow here. If it throws, the RingBuffer is not being serviced adequately.
                 // It is up to the client to manage and/or mitigate this possibility.
-                auto putFunk = [ this, val ]() { this->Base::put( val ); };
-                semaphore.give(std::ref(putFunk));
+                putGuarded( val, [ this ]( auto & putFunk ) { semaphore.give( std::ref( putFunk ) ); return true; } );
+            }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation will attempt to retrieve a value from the base implementation without blocking.
+            * If the base is in an empty condition, it returns immediately with an empty optional. Empty is reported,
+            * not thrown. Otherwise, it behaves as the get operation does.
+            *
+            * @pre The ring buffer is expected to be in the "Ready" state to invoke this operation. Violations will result in an exception
+            * being thrown.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @return Returns an optional holding a value of T retrieved from the implementation. It has no value if empty.
+            */
+            inline std::optional< T > tryGet()
+            {
+                // We have to be in the "Ready" state, or we will throw a logic error.
+                if ( state != State::Ready )
+                {
+                    throw RingBufferStateError{ "RingBufferGuarded::tryGet invoked while not in the Ready state!" };
+                }
+
+                // A value is only retrieved if the semaphore was taken, so the base will not be empty.
+                auto takeOperation = [ this ]( auto & getFunk ) { return semaphore.tryTake( std::ref( getFunk ) ); };
+                auto retVal = getGuarded( takeOperation );
+
+                // If empty, clear our readiness, if any, and check once more. A value put before the clear did not
+                // signal readiness. One put after it will.
+                if ( !retVal && pReadiness )
+                {
+                    pReadiness->clear();
+                    retVal = getGuarded( takeOperation );
+                }
+                return retVal;
+            }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation will attempt to put a value into the base implementation without blocking.
+            * If the base is in a full condition, it returns false immediately. Full is reported, not thrown.
+            * Otherwise, it behaves as the put operation does.
+            *
+            * @pre The ring buffer is expected to be in the "Ready" state to invoke this operation. Violations will result in an exception
+            * being thrown.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" or "Terminal" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param val A value to be put into the ring buffer implementation.
+            *
+            * @return Returns true if the value was put. Returns false if full or in the "Terminal" state.
+            */
+            inline bool tryPut( ParamType val )
+            {
+                // If we are in the terminal state, we will just get out of the way
+                if ( state == State::Terminal ) return false;
+
+                // We have to be in the "Ready" state, or we will throw a logic error.
+                if ( state != State::Ready )
+                {
+                    throw RingBufferStateError{ "RingBufferGuarded::tryPut invoked while not in the Ready state!" };
+                }
+
+                // The value is only put should there be room. The semaphore has then reserved room, so the base put
+                // will not throw.
+                return putGuarded( val, [ this ]( auto & putFunk ) { return semaphore.tryGive( std::ref( putFunk ) ); } );
+            }
+
+            /**
+            * @brief The Get All Operation
+            *
+            * This operation will retrieve every value available from the base implementation, writing them in order
+            * through the output iterator provided. If the base is in an empty condition, it will block until a value
+            * becomes available, as the get operation does. All values are then retrieved within the context of a single
+            * semaphore take, rather than one take per value.
+            *
+            * @pre The ring buffer is expected to be in the "Ready" state to invoke this operation. Violations will result in an exception
+            * being thrown.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @tparam OutputIt An output iterator type to which T may be assigned.
+            * @param dst The output iterator to write values through.
+            * @warning The destination must have room for as many values as the ring buffer can hold.
+            *
+            * @return Returns the number of values retrieved, which is at least one.
+            */
+            template< typename OutputIt >
+            inline size_t getAll( OutputIt dst )
+            {
+                return getEach( [ &dst ]( T val ) { *dst++ = val; }, std::numeric_limits< size_t >::max() );
+            }
+
+            /**
+            * @brief The Get Up To Operation
+            *
+            * This operation behaves as the getAll operation does, except that no more than maxCount values are
+            * retrieved into the array provided.
+            *
+            * @pre The ring buffer is expected to be in the "Ready" state to invoke this operation. Violations will result in an exception
+            * being thrown.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param dst The array to retrieve values into.
+            * @param maxCount The maximum number of values to retrieve. If zero, we return zero immediately.
+            *
+            * @return Returns the number of values retrieved.
+            */
+            inline size_t getUpTo( T * dst, size_t maxCount )
+            {
+                return getEach( [ &dst ]( T val ) { *dst++ = val; }, maxCount );
+            }
+
+            /**
+            * @brief The Get Until Operation
+            *
+            * This operation will retrieve a value from the base implementation, blocking while empty but no later than
+            * the deadline specified. If still empty at the deadline, it returns an empty optional. Otherwise, it behaves
+            * as the get operation does. This allows a periodic task to service the ring buffer or fall through to
+            * other work within its frame budget.
+            *
+            * @pre The ring buffer is expected to be in the "Ready" state to invoke this operation. Violations will result in an exception
+            * being thrown.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param deadline The steady clock time point after which we will no longer wait.
+            *
+            * @return Returns an optional holding a value of T retrieved from the implementation. It has no value if
+            * the deadline passed.
+            */
+            inline std::optional< T > getUntil( const TimePointType & deadline )
+            {
+                // We have to be in the "Ready" state, or we will throw a logic error.
+                if ( state != State::Ready )
+                {
+                    throw RingBufferStateError{ "RingBufferGuarded::getUntil invoked while not in the Ready state!" };
+                }
+
+                // A value is only retrieved if the semaphore was taken before the deadline, so the base will not be empty.
+                return getGuarded( [ this, &deadline ]( auto & getFunk )
+                    { return semaphore.tryTakeUntil( std::ref( getFunk ), deadline ); } );
+            }
+
+            /**
+            * @brief The Try Get For Operation
+            *
+            * This operation behaves as the getUntil operation does, with a deadline of the timeout specified from now.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param timeout The maximum duration to wait.
+            *
+            * @return Returns an optional holding a value of T retrieved from the implementation. It has no value if
+            * the timeout expired.
+            */
+            template< typename Rep, typename Period >
+            inline std::optional< T > tryGetFor( const std::chrono::duration< Rep, Period > & timeout )
+            {
+                // We have to be in the "Ready" state, or we will throw a logic error.
+                if ( state != State::Ready )
+                {
+                    throw RingBufferStateError{ "RingBufferGuarded::tryGetFor invoked while not in the Ready state!" };
+                }
+
+                // A value is only retrieved if the semaphore was taken before the timeout, so the base will not be empty.
+                return getGuarded( [ this, &timeout ]( auto & getFunk )
+                    { return semaphore.tryTakeFor( std::ref( getFunk ), timeout ); } );
+            }
+
+            /**
+            * @brief The Put Until Operation
+            *
+            * This operation will put a value into the base implementation, blocking while full but no later than
+            * the deadline specified. If still full at the deadline, it returns false. Otherwise, it behaves as the
+            * put operation does.
+            *
+            * @pre The ring buffer is expected to be in the "Ready" state to invoke this operation. Violations will result in an exception
+            * being thrown.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" or "Terminal" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param val A value to be put into the ring buffer implementation.
+            * @param deadline The steady clock time point after which we will no longer wait.
+            *
+            * @return Returns true if the value was put. Returns false if the deadline passed or in the "Terminal" state.
+            */
+            inline bool putUntil( ParamType val, const TimePointType & deadline )
+            {
+                // If we are in the terminal state, we will just get out of the way
+                if ( state == State::Terminal ) return false;
+
+                // We have to be in the "Ready" state, or we will throw a logic error.
+                if ( state != State::Ready )
+                {
+                    throw RingBufferStateError{ "RingBufferGuarded::putUntil invoked while not in the Ready state!" };
+                }
+
+                // The value is only put should there be room before the deadline.
+                return putGuarded( val, [ this, &deadline ]( auto & putFunk )
+                    { return semaphore.tryGiveUntil( std::ref( putFunk ), deadline ); } );
+            }
+
+            /**
+            * @brief The Try Put For Operation
+            *
+            * This operation behaves as the putUntil operation does, with a deadline of the timeout specified from now.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" or "Terminal" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param val A value to be put into the ring buffer implementation.
+            * @param timeout The maximum duration to wait.
+            *
+            * @return Returns true if the value was put. Returns false if the timeout expired or in the "Terminal" state.
+            */
+            template< typename Rep, typename Period >
+            inline bool tryPutFor( ParamType val, const std::chrono::duration< Rep, Period > & timeout )
+            {
+                // If we are in the terminal state, we will just get out of the way
+                if ( state == State::Terminal ) return false;
+
+                // We have to be in the "Ready" state, or we will throw a logic error.
+                if ( state != State::Ready )
+                {
+                    throw RingBufferStateError{ "RingBufferGuarded::tryPutFor invoked while not in the Ready state!" };
+                }
+
+                // The value is only put should there be room before the timeout.
+                return putGuarded( val, [ this, &timeout ]( auto & putFunk )
+                    { return semaphore.tryGiveFor( std::ref( putFunk ), timeout ); } );
+            }
+
+            /**
+            * @brief The Put Overwrite Operation
+            *
+            * This operation will put a value into the base implementation without ever blocking. If the ring buffer is
+            * full, the oldest value is evicted to make room and the dropped count is incremented. This suits high rate
+            * producers (e.g., telemetry) that must never stall on a slow consumer. Either way, the base class
+            * functionality is invoked while in the context of our counted semaphore's internal lock.
+            *
+            * @pre The ring buffer is expected to be in the "Ready" state to invoke this operation. Violations will result in an exception
+            * being thrown.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" or "Terminal" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @note Unavailable with a SingleConsumer policy, as eviction gets within the context of the lock.
+            *
+            * @param val A value to be put into the ring buffer implementation.
+            *
+            * @return Returns an optional holding the value evicted. It has no value if nothing was evicted
+            * or in the "Terminal" state.
+            */
+            inline std::optional< T > putOverwrite( ParamType val )
+            {
+                static_assert( !singleConsumer, "RingBufferGuarded::putOverwrite requires a MultiConsumer policy!" );
+
+                // If we are in the terminal state, we will just get out of the way
+                if ( state == State::Terminal ) return std::nullopt;
+
+                // We have to be in the "Ready" state, or we will throw a logic error.
+                if ( state != State::Ready )
+                {
+                    throw RingBufferStateError{ "RingBufferGuarded::putOverwrite invoked while not in the Ready state!" };
+                }
+
+                // Set up lambdas to be invoked in the context of the semaphore's internal lock. If there is room,
+                // we simply put. Otherwise, we evict and put, leaving the semaphore's available count unchanged.
+                // We cannot rely on the base to evict as our capacity, the semaphore's maximum available count,
+                // may be less than that of the base.
+                std::optional< T > retVal;
+                auto putFunk = [ this, &val ]() { putLocked( val ); };
+                auto replaceFunk = [ this, &val, &retVal ]()
+                {
+                    retVal = getLocked();
+                    putLocked( val );
+                    droppedCount.fetch_add( 1, std::memory_order_relaxed );
+                };
+                semaphore.giveOrReplace(std::ref(putFunk), std::ref(replaceFunk));
+                signalReadiness();
+                return retVal;
+            }
+
+            /**
+            * @brief The Get Readiness File Descriptor Operation
+            *
+            * This operation returns a file descriptor that is readable whenever values may be available, if enabled at
+            * construction. A thread may wait upon it, alongside others, with epoll (EPOLLIN), poll or select. Once woken,
+            * it must invoke tryGet until empty is reported, which also clears readiness. It may be woken to find nothing.
+            * Blocking get operations may be freely mixed, though they do not clear readiness.
+            *
+            * @return Returns the readiness file descriptor, or -1 if not enabled at construction.
+            */
+            [[nodiscard]] inline int getReadinessFd() const noexcept { return pReadiness ? pReadiness->getFd() : -1; }
+
+            /**
+            * @brief The Get Dropped Count Operation
+            *
+            * This operation returns the number of values evicted by the putOverwrite operation since construction.
+            * It may be invoked from any thread without taking our semaphore's internal lock.
+            *
+            * @return Returns the number of values evicted by the putOverwrite operation.
+            */
+            [[nodiscard]] inline size_t getDroppedCount() const noexcept
+            {
+                return droppedCount.load( std::memory_order_relaxed );
             }
 
             /**
@@ -232,6 +636,8 @@ namespace ReiserRT
                 {   // If the current state transitions to Terminal, then we will not go "Ready".
                     if ( currentState == State::Terminal ) return;
                 } while ( !state.compare_exchange_weak( currentState, State::Ready ) );
+
+                if ( 0 != count ) signalReadiness();
             }
 
             /**
@@ -292,7 +698,145 @@ namespace ReiserRT
             */
             using Base::getMask;
 
+        protected:
+            /**
+            * @brief The Get Each Operation
+            *
+            * This operation blocks until a value is available and then retrieves, up to maxCount, every value available
+            * within the context of a single semaphore take, invoking the operation provided with each in order.
+            * It serves the getAll and getUpTo operations, as well as those of derived classes that convert values.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param operation A function object accepting a value of T. It must not throw.
+            * @param maxCount The maximum number of values to retrieve.
+            *
+            * @return Returns the number of values retrieved.
+            */
+            template< typename Operation >
+            inline size_t getEach( Operation && operation, size_t maxCount )
+            {
+                // We have to be in the "Ready" state, or we will throw a logic error.
+                if ( state != State::Ready )
+                {
+                    throw RingBufferStateError{ "RingBufferGuarded::getAll/getUpTo invoked while not in the Ready state!" };
+                }
+
+                // Set up a lambda to be invoked in the context of the semaphore's internal lock, once taken.
+                // The base holds at least as many values as the count taken. These are retrieved within the lock,
+                // even for a single consumer, as our spare element covers but one value taken and not yet retrieved.
+                auto getFunk = [ this, &operation ]( size_t count )
+                {
+                    for ( size_t i = 0; count != i; ++i ) operation( getLocked() );
+                };
+                return semaphore.takeAvailable( std::ref( getFunk ), maxCount );
+            }
+
         private:
+            /**
+            * @brief The Put Guarded Operation
+            *
+            * This operation puts a value by way of the semaphore give operation provided, signalling readiness if it
+            * succeeds. A single producer writes the value into the next base slot first, invokes the give operation
+            * with a functor doing nothing and only then advances the base put counter. Nothing need be undone should
+            * the give fail. Otherwise, the give operation is invoked with a functor which puts the value in the
+            * context of the semaphore's internal lock.
+            *
+            * @param val A value to be put into the ring buffer implementation.
+            * @param giveOperation A callable invoking a semaphore give operation with the functor passed it,
+            * returning true if the semaphore was given.
+            *
+            * @return Returns true if the value was put.
+            */
+            template< typename GiveOperation >
+            inline bool putGuarded( ParamType val, GiveOperation && giveOperation )
+            {
+                if constexpr ( singleProducer )
+                {
+                    this->Base::putSlot() = val;
+                    auto publishFunk = []() {};
+                    if ( !giveOperation( publishFunk ) ) return false;
+                    this->Base::advancePut();
+                }
+                else
+                {
+                    auto putFunk = [ this, &val ]() { putLocked( val ); };
+                    if ( !giveOperation( putFunk ) ) return false;
+                }
+                signalReadiness();
+                return true;
+            }
+
+            /**
+            * @brief The Get Guarded Operation
+            *
+            * This operation gets a value by way of the semaphore take operation provided. A single consumer invokes
+            * the take operation with a functor doing nothing and then reads the oldest base slot outside of the lock.
+            * Otherwise, the take operation is invoked with a functor which gets the value in the context of the
+            * semaphore's internal lock.
+            *
+            * @param takeOperation A callable invoking a semaphore take operation with the functor passed it,
+            * returning true if the semaphore was taken.
+            *
+            * @return Returns an optional holding the value retrieved. It has no value if the semaphore was not taken.
+            */
+            template< typename TakeOperation >
+            inline std::optional< T > getGuarded( TakeOperation && takeOperation )
+            {
+                std::optional< T > retVal;
+                if constexpr ( singleConsumer )
+                {
+                    auto claimFunk = []() {};
+                    if ( takeOperation( claimFunk ) ) retVal = this->Base::getUnchecked();
+                }
+                else
+                {
+                    auto getFunk = [ this, &retVal ]() { retVal = getLocked(); };
+                    takeOperation( getFunk );
+                }
+                return retVal;
+            }
+
+            /**
+            * @brief The Put Locked Operation
+            *
+            * This operation puts a value into the base within the context of our semaphore's internal lock.
+            * The semaphore has ensured there is room.
+            *
+            * @param val A value to be put into the ring buffer implementation.
+            */
+            inline void putLocked( ParamType val )
+            {
+                if constexpr ( checkedAccess ) Base::put( val );
+                else
+                {
+                    this->Base::putSlot() = val;
+                    this->Base::advancePut();
+                }
+            }
+
+            /**
+            * @brief The Get Locked Operation
+            *
+            * This operation gets a value from the base within the context of our semaphore's internal lock.
+            * The semaphore has ensured there is one.
+            *
+            * @return Returns the value retrieved.
+            */
+            inline T getLocked()
+            {
+                if constexpr ( checkedAccess ) return Base::get();
+                else return this->Base::getUnchecked();
+            }
+
+            /**
+            * @brief The Signal Readiness Operation
+            *
+            * This operation signals our readiness event, if enabled, after a value has been put.
+            */
+            inline void signalReadiness() noexcept { if ( pReadiness ) pReadiness->signal(); }
+
             /**
             * @brief The Counted Semaphore Object.
             *
@@ -307,27 +851,45 @@ namespace ReiserRT
             * This attribute tracks our state, using C++11 atomic data types which is lock-free, thread safe.
             */
             AtomicStateType state;
+
+            /**
+            * @brief The Dropped Count
+            *
+            * This attribute counts values evicted by the putOverwrite operation. It is only modified within the context
+            * of our semaphore's internal lock but, may be read at any time.
+            */
+            std::atomic< size_t > droppedCount{ 0 };
+
+            /**
+            * @brief The Readiness Event
+            *
+            * This attribute provides our readiness file descriptor. It is null unless enabled at construction.
+            */
+            std::unique_ptr< ReadinessEvent > pReadiness;
         };
 
         /**
         * @brief RingBufferGuarded Class
         *
-        * This template class provides a template for simple scalar types (not pointer types). It is derived from
+        * This template class provides a template for simple value types (not pointer types). It is derived from
         * RingBufferGuardedBase of the same template argument type which own an implementation instance.
         *
         * @tparam T The ring buffer element type (not for pointer types).
-        * @note Must be a scalar type (e.g., char, int, float).
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float or a small POD
+        * structure).
+        * @tparam ProducerPolicy SingleProducer or MultiProducer (the default) (@see RingBufferGuardedBase).
+        * @tparam ConsumerPolicy SingleConsumer or MultiConsumer (the default) (@see RingBufferGuardedBase).
         */
-        template< typename T >
-        class RingBufferGuarded : public RingBufferGuardedBase< T >
+        template< typename T, typename ProducerPolicy = MultiProducer, typename ConsumerPolicy = MultiConsumer >
+        class RingBufferGuarded : public RingBufferGuardedBase< T, ProducerPolicy, ConsumerPolicy >
         {
         private:
             /**
-            * @brief Alias Type to RingBufferGuardedBase< T >
+            * @brief Alias Type to RingBufferGuardedBase< T, ProducerPolicy, ConsumerPolicy >
             *
             * This type provides a little "syntactic sugar" for the class.
             */
-            using Base = RingBufferGuardedBase< T >;
+            using Base = RingBufferGuardedBase< T, ProducerPolicy, ConsumerPolicy >;
 
         public:
             /**
@@ -352,6 +914,83 @@ namespace ReiserRT
             */
             using Base::put;
 
+            /**
+            * @brief Inherit the Try Get Operation
+            *
+            * This declaration brings the tryGet operation from our Base class into the public scope.
+            */
+            using Base::tryGet;
+
+            /**
+            * @brief Inherit the Try Put Operation
+            *
+            * This declaration brings the tryPut operation from our Base class into the public scope.
+            */
+            using Base::tryPut;
+
+            /**
+            * @brief Inherit the Get All Operation
+            *
+            * This declaration brings the getAll operation from our Base class into the public scope.
+            */
+            using Base::getAll;
+
+            /**
+            * @brief Inherit the Get Up To Operation
+            *
+            * This declaration brings the getUpTo operation from our Base class into the public scope.
+            */
+            using Base::getUpTo;
+
+            /**
+            * @brief Inherit the Get Until Operation
+            *
+            * This declaration brings the getUntil operation from our Base class into the public scope.
+            */
+            using Base::getUntil;
+
+            /**
+            * @brief Inherit the Try Get For Operation
+            *
+            * This declaration brings the tryGetFor operation from our Base class into the public scope.
+            */
+            using Base::tryGetFor;
+
+            /**
+            * @brief Inherit the Put Until Operation
+            *
+            * This declaration brings the putUntil operation from our Base class into the public scope.
+            */
+            using Base::putUntil;
+
+            /**
+            * @brief Inherit the Try Put For Operation
+            *
+            * This declaration brings the tryPutFor operation from our Base class into the public scope.
+            */
+            using Base::tryPutFor;
+
+            /**
+            * @brief Inherit the Put Overwrite Operation
+            *
+            * This declaration brings the putOverwrite operation from our Base class into the public scope.
+            */
+            using Base::putOverwrite;
+
+            /**
+            * @brief Inherit the Get Dropped Count Operation
+            *
+            * This declaration brings the getDroppedCount operation from our Base class into the public scope.
+            */
+            using Base::getDroppedCount;
+
+            /**
+            * @brief Inherit the Get Readiness File Descriptor Operation
+            *
+            * This declaration brings the getReadinessFd operation from our Base class into the public scope.
+            */
+            using Base::getReadinessFd;
+
             /**
             * @brief Inherit the Abort Operation
             *
@@ -402,17 +1041,21 @@ namespace ReiserRT
         * type values. It was designed to handle a wide variety of concrete typed pointers
         * that can transparently be cast back and forth with void pointers, thereby simplifying
         * the type pointer template. It inherits directly from the RingBufferGuardedBase.
+        *
+        * @tparam ProducerPolicy SingleProducer or MultiProducer (@see RingBufferGuardedBase).
+        * @tparam ConsumerPolicy SingleConsumer or MultiConsumer (@see RingBufferGuardedBase).
         */
-        template<>
-        class RingBufferGuarded< void * > : public RingBufferGuardedBase< void * >
+        template< typename ProducerPolicy, typename ConsumerPolicy >
+        class RingBufferGuarded< void *, ProducerPolicy, ConsumerPolicy >
+            : public RingBufferGuardedBase< void *, ProducerPolicy, ConsumerPolicy >
         {
         private:
             /**
-            * @brief Alias Type to RingBufferGuardedBase< void * >
+            * @brief Alias Type to RingBufferGuardedBase< void *, ProducerPolicy, ConsumerPolicy >
             *
             * This type provides a little "syntactic sugar" for the class.
             */
-            using Base = RingBufferGuardedBase< void * >;
+            using Base = RingBufferGuardedBase< void *, ProducerPolicy, ConsumerPolicy >;
 
         public:
             /**
@@ -437,6 +1080,83 @@ namespace ReiserRT
             */
             using Base::put;
 
+            /**
+            * @brief Inherit the Try Get Operation
+            *
+            * This declaration brings the tryGet operation from our Base class into the public scope.
+            */
+            using Base::tryGet;
+
+            /**
+            * @brief Inherit the Try Put Operation
+            *
+            * This declaration brings the tryPut operation from our Base class into the public scope.
+            */
+            using Base::tryPut;
+
+            /**
+            * @brief Inherit the Get All Operation
+            *
+            * This declaration brings the getAll operation from our Base class into the public scope.
+            */
+            using Base::getAll;
+
+            /**
+            * @brief Inherit the Get Up To Operation
+            *
+            * This declaration brings the getUpTo operation from our Base class into the public scope.
+            */
+            using Base::getUpTo;
+
+            /**
+            * @brief Inherit the Get Until Operation
+            *
+            * This declaration brings the getUntil operation from our Base class into the public scope.
+            */
+            using Base::getUntil;
+
+            /**
+            * @brief Inherit the Try Get For Operation
+            *
+            * This declaration brings the tryGetFor operation from our Base class into the public scope.
+            */
+            using Base::tryGetFor;
+
+            /**
+            * @brief Inherit the Put Until Operation
+            *
+            * This declaration brings the putUntil operation from our Base class into the public scope.
+            */
+            using Base::putUntil;
+
+            /**
+            * @brief Inherit the Try Put For Operation
+            *
+            * This declaration brings the tryPutFor operation from our Base class into the public scope.
+            */
+            using Base::tryPutFor;
+
+            /**
+            * @brief Inherit the Put Overwrite Operation
+            *
+            * This declaration brings the putOverwrite operation from our Base class into the public scope.
+            */
+            using Base::putOverwrite;
+
+            /**
+            * @brief Inherit the Get Dropped Count Operation
+            *
+            * This declaration brings the getDroppedCount operation from our Base class into the public scope.
+            */
+            using Base::getDroppedCount;
+
+            /**
+            * @brief Inherit the Get Readiness File Descriptor Operation
+            *
+            * This declaration brings the getReadinessFd operation from our Base class into the public scope.
+            */
+            using Base::getReadinessFd;
+
             /**
             * @brief Inherit the Abort Operation
             *
@@ -485,17 +1205,21 @@ namespace ReiserRT
         *
         * This partial specialization is provided for pointers to any type to be put into or retrieved from
         * a RingBufferGuarded. It relies on its base class, RingBufferGuarded< void * >, for all but a cast to and fro.
+        *
+        * @tparam ProducerPolicy SingleProducer or MultiProducer (@see RingBufferGuardedBase).
+        * @tparam ConsumerPolicy SingleConsumer or MultiConsumer (@see RingBufferGuardedBase).
         */
-        template< typename T >
-        class RingBufferGuarded< T * > : public RingBufferGuarded< void * >
+        template< typename T, typename ProducerPolicy, typename ConsumerPolicy >
+        class RingBufferGuarded< T *, ProducerPolicy, ConsumerPolicy >
+            : public RingBufferGuarded< void *, ProducerPolicy, ConsumerPolicy >
         {
         private:
             /**
-            * @brief Alias Type to RingBufferGuarded< void * >
+            * @brief Alias Type to RingBufferGuarded< void *, ProducerPolicy, ConsumerPolicy >
             *
             * This type provides a little "syntactic sugar" for the class.
             */
-            using Base = RingBufferGuarded< void * >;
+            using Base = RingBufferGuarded< void *, ProducerPolicy, ConsumerPolicy >;
 
             /**
             * @brief Required Put Type
@@ -508,6 +1232,13 @@ namespace ReiserRT
             using PutType = typename std::remove_const<T>::type *;
 
         public:
+            /**
+            * @brief The Time Point Type
+            *
+            * Deadlines for timed operations are specified upon the steady clock (CLOCK_MONOTONIC under Linux).
+            */
+            using TimePointType = typename Base::TimePointType;
+
             /**
             * @brief Inherit Constructors from Base Class
             *
@@ -565,6 +1296,180 @@ namespace ReiserRT
             * @param p A pointer to the object to be put into the ring buffer implementation.
             */
             inline void put( T * p ) { Base::put( const_cast< PutType >( p ) ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation invokes the base class to try retrieving a void pointer to the specified type
+            * from the base RingBufferGuarded without blocking. Any value retrieved is converted to a pointer of the
+            * specified templated type.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @return Returns an optional holding a pointer to an object of type T. It has no value if empty.
+            */
+            inline std::optional< T * > tryGet()
+            {
+                auto val = Base::tryGet();
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation invokes the base class to try putting a typed pointer value into the base RingBufferGuarded
+            * without blocking.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            *
+            * @return Returns true if the pointer was put. Returns false if full or in the "Terminal" state.
+            */
+            inline bool tryPut( T * p ) { return Base::tryPut( const_cast< PutType >( p ) ); }
+
+            /**
+            * @brief The Get All Operation
+            *
+            * This operation invokes the base class to retrieve every void pointer available, blocking until at least
+            * one is. Each is converted to a pointer of the specified templated type and written through the output
+            * iterator provided.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @tparam OutputIt An output iterator type to which a pointer to T may be assigned.
+            * @param dst The output iterator to write pointers through.
+            *
+            * @return Returns the number of pointers retrieved, which is at least one.
+            */
+            template< typename OutputIt >
+            inline size_t getAll( OutputIt dst )
+            {
+                return Base::getEach( [ &dst ]( void * val ) { *dst++ = reinterpret_cast< T* >( val ); },
+                                      std::numeric_limits< size_t >::max() );
+            }
+
+            /**
+            * @brief The Get Up To Operation
+            *
+            * This operation behaves as the getAll operation does, except that no more than maxCount pointers are
+            * retrieved into the array provided.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param dst The array to retrieve pointers into.
+            * @param maxCount The maximum number of pointers to retrieve. If zero, we return zero immediately.
+            *
+            * @return Returns the number of pointers retrieved.
+            */
+            inline size_t getUpTo( T ** dst, size_t maxCount )
+            {
+                return Base::getEach( [ &dst ]( void * val ) { *dst++ = reinterpret_cast< T* >( val ); }, maxCount );
+            }
+
+            /**
+            * @brief The Get Until Operation
+            *
+            * This operation invokes the base class to retrieve a void pointer to the specified type
+            * from the base RingBufferGuarded, blocking no later than the deadline specified. Any value retrieved
+            * is converted to a pointer of the specified templated type.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param deadline The steady clock time point after which we will no longer wait.
+            *
+            * @return Returns an optional holding a pointer to an object of type T. It has no value if the deadline passed.
+            */
+            inline std::optional< T * > getUntil( const TimePointType & deadline )
+            {
+                auto val = Base::getUntil( deadline );
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
+
+            /**
+            * @brief The Try Get For Operation
+            *
+            * This operation invokes the base class to retrieve a void pointer to the specified type
+            * from the base RingBufferGuarded, blocking no longer than the timeout specified. Any value retrieved
+            * is converted to a pointer of the specified templated type.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param timeout The maximum duration to wait.
+            *
+            * @return Returns an optional holding a pointer to an object of type T. It has no value if the timeout expired.
+            */
+            template< typename Rep, typename Period >
+            inline std::optional< T * > tryGetFor( const std::chrono::duration< Rep, Period > & timeout )
+            {
+                auto val = Base::tryGetFor( timeout );
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
+
+            /**
+            * @brief The Put Until Operation
+            *
+            * This operation invokes the base class to put a typed pointer value into the base RingBufferGuarded,
+            * blocking no later than the deadline specified.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            * @param deadline The steady clock time point after which we will no longer wait.
+            *
+            * @return Returns true if the pointer was put. Returns false if the deadline passed or in the "Terminal" state.
+            */
+            inline bool putUntil( T * p, const TimePointType & deadline )
+            {
+                return Base::putUntil( const_cast< PutType >( p ), deadline );
+            }
+
+            /**
+            * @brief The Try Put For Operation
+            *
+            * This operation invokes the base class to put a typed pointer value into the base RingBufferGuarded,
+            * blocking no longer than the timeout specified.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            * @param timeout The maximum duration to wait.
+            *
+            * @return Returns true if the pointer was put. Returns false if the timeout expired or in the "Terminal" state.
+            */
+            template< typename Rep, typename Period >
+            inline bool tryPutFor( T * p, const std::chrono::duration< Rep, Period > & timeout )
+            {
+                return Base::tryPutFor( const_cast< PutType >( p ), timeout );
+            }
+
+            /**
+            * @brief The Put Overwrite Operation
+            *
+            * This operation invokes the base class to put a typed pointer value into the base RingBufferGuarded,
+            * evicting the oldest pointer if full. Any pointer evicted is converted to a pointer of the specified
+            * template type. The caller is responsible for the evicted object (e.g., returning it to its pool).
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStateError if not in the "Ready" or "Terminal" state.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the semaphore is aborted.
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            *
+            * @return Returns an optional holding the pointer evicted. It has no value if nothing was evicted.
+            */
+            inline std::optional< T * > putOverwrite( T * p )
+            {
+                auto val = Base::putOverwrite( const_cast< PutType >( p ) );
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
         };
 
     }
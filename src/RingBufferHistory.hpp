@@ -0,0 +1,348 @@
+/**
+* @file RingBufferHistory.hpp
+* @brief The Specification file for RingBufferHistory
+*
+* This file came into existence to provide control loops with allocation free, logarithmic time lookups into
+* their recent history (e.g., "all entries in the last 5 ms" or "the entry at or before t") at high rates.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERHISTORY_HPP
+#define REISERRT_CORE_RINGBUFFERHISTORY_HPP
+
+#include "RingBufferSimple.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief RingBufferHistory Class
+        *
+        * This template class records the most recent values of a signal, each stamped with a monotonic time point,
+        * in a RingBufferSimple of entries. When full, the oldest entry is overwritten. Since time points never
+        * decrease, the occupied range is sorted by time and is searched by bisection through the random access
+        * iterator of RingBufferSimple, which applies the ring buffer index mask to each probe. Queries neither
+        * copy nor allocate. A range of entries is returned as a Window of iterators into the history.
+        *
+        * @warning RingBufferHistory provides no thread safety. A Window is invalidated by any subsequent put.
+        *
+        * @tparam T The value type.
+        * @note Must be a trivially copyable type small enough that an Entry (a time point and a value) fits
+        * within a cache line.
+        * @tparam N The compile time capacity. Zero (the default) specifies that capacity is determined at construction.
+        * @tparam ClockT The clock providing time points. It should be monotonic. The default is std::chrono::steady_clock.
+        */
+        template< typename T, size_t N = 0, typename ClockT = std::chrono::steady_clock >
+        class RingBufferHistory
+        {
+        private:
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar values are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
+
+        public:
+            /**
+            * @brief The Time Point Type
+            *
+            * This is the time point type of our clock.
+            */
+            using TimePoint = typename ClockT::time_point;
+
+            /**
+            * @brief The Duration Type
+            *
+            * This is the duration type of our clock.
+            */
+            using Duration = typename ClockT::duration;
+
+            /**
+            * @brief The Entry Type
+            *
+            * This structure pairs a value with the time point at which it was recorded.
+            */
+            struct Entry
+            {
+                TimePoint time; //!< The time point at which the value was recorded.
+                T value;        //!< The value recorded.
+            };
+
+        private:
+            /**
+            * @brief The Ring Buffer Type
+            *
+            * This is the type of ring buffer that holds our entries.
+            */
+            using RingBufferType = RingBufferSimple< Entry, N >;
+
+        public:
+            /**
+            * @brief The Constant Iterator Type
+            *
+            * This type iterates over entries, oldest to newest.
+            */
+            using ConstIterator = typename RingBufferType::ConstIterator;
+
+            /**
+            * @brief The Window Class
+            *
+            * This class denotes a contiguous (in time) range of entries within the history. It may be iterated
+            * with a range based for loop. It refers into the history and is invalidated by any subsequent put.
+            */
+            class Window
+            {
+            public:
+                /**
+                * @brief Qualified Constructor for Window
+                *
+                * @param theFirst An iterator referring to the first entry of the window.
+                * @param theLast An iterator referring past the last entry of the window.
+                */
+                Window( ConstIterator theFirst, ConstIterator theLast ) noexcept : first{ theFirst }, last{ theLast } {}
+
+                /**
+                * @brief The Begin Operation
+                *
+                * @return Returns an iterator referring to the first entry of the window.
+                */
+                [[nodiscard]] inline ConstIterator begin() const noexcept { return first; }
+
+                /**
+                * @brief The End Operation
+                *
+                * @return Returns an iterator referring past the last entry of the window.
+                */
+                [[nodiscard]] inline ConstIterator end() const noexcept { return last; }
+
+                /**
+                * @brief The Size Operation
+                *
+                * @return Returns the number of entries within the window.
+                */
+                [[nodiscard]] inline size_t size() const noexcept { return size_t( last - first ); }
+
+                /**
+                * @brief The Empty Operation
+                *
+                * @return Returns true if there are no entries within the window.
+                */
+                [[nodiscard]] inline bool empty() const noexcept { return first == last; }
+
+            private:
+                /**
+                * @brief The First Iterator
+                *
+                * An iterator referring to the first entry of the window.
+                */
+                ConstIterator first;
+
+                /**
+                * @brief The Last Iterator
+                *
+                * An iterator referring past the last entry of the window.
+                */
+                ConstIterator last;
+            };
+
+            /**
+            * @brief Qualified Constructor for RingBufferHistory
+            *
+            * @param requestedNumElements The requested number of entries. The actual size will be the next power of two.
+            * @note This constructor is only available when N is zero.
+            */
+            template< size_t M = N, typename std::enable_if< M == 0, int >::type = 0 >
+            explicit RingBufferHistory( size_t requestedNumElements ) : ringBuffer{ requestedNumElements }
+            {
+            }
+
+            /**
+            * @brief Default Constructor for RingBufferHistory
+            *
+            * This constructor instantiates a RingBufferHistory whose capacity was determined at compile time.
+            * @note This constructor is only available when N is non-zero.
+            */
+            template< size_t M = N, typename std::enable_if< M != 0, int >::type = 0 >
+            RingBufferHistory() : ringBuffer{}
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferHistory
+            *
+            * Copying RingBufferHistory is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferHistory of the same templated type.
+            */
+            RingBufferHistory( const RingBufferHistory & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferHistory
+            *
+            * Copy assignment of RingBufferHistory is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferHistory of the same templated type.
+            */
+            RingBufferHistory & operator =( const RingBufferHistory & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferHistory
+            *
+            * Moving RingBufferHistory is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferHistory of the same templated type.
+            */
+            RingBufferHistory( RingBufferHistory && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferHistory
+            *
+            * Move assignment of RingBufferHistory is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferHistory of the same templated type.
+            */
+            RingBufferHistory & operator =( RingBufferHistory && another ) = delete;
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation records a value stamped with a time point. If full, the oldest entry is overwritten.
+            * @throw Throws ReiserRT::Core::RingBufferStateError if the time point precedes that of the newest entry.
+            *
+            * @param time The time point at which the value was observed.
+            * @param val The value to record.
+            */
+            void put( TimePoint time, ParamType val )
+            {
+                if ( 0 != ringBuffer.getAvailableCount() && time < newestTime )
+                {
+                    throw RingBufferStateError{ "RingBufferHistory::put() time point precedes the newest entry!" };
+                }
+                ringBuffer.putOverwrite( Entry{ time, val } );
+                newestTime = time;
+            }
+
+            /**
+            * @brief The Put Now Operation
+            *
+            * This operation records a value stamped with the current time point of our clock.
+            * @throw Throws ReiserRT::Core::RingBufferStateError if the clock is not monotonic and has gone backwards.
+            *
+            * @param val The value to record.
+            */
+            inline void put( ParamType val ) { put( ClockT::now(), val ); }
+
+            /**
+            * @brief The Get At or Before Operation
+            *
+            * This operation finds the newest entry recorded at or before a time point by bisection.
+            *
+            * @param time The time point of interest.
+            *
+            * @return Returns an optional holding a copy of the entry. It has no value if the history is empty
+            * or all entries are newer than the time point.
+            */
+            [[nodiscard]] std::optional< Entry > getAtOrBefore( TimePoint time ) const noexcept
+            {
+                auto it = std::upper_bound( ringBuffer.begin(), ringBuffer.end(), time,
+                                            []( TimePoint t, const Entry & e ){ return t < e.time; } );
+                if ( it == ringBuffer.begin() ) return std::nullopt;
+                return *--it;
+            }
+
+            /**
+            * @brief The Get Since Operation
+            *
+            * This operation finds the entries recorded at or after a time point by bisection.
+            *
+            * @param since The time point of interest.
+            *
+            * @return Returns a window over the entries recorded at or after the time point, oldest to newest.
+            */
+            [[nodiscard]] Window getSince( TimePoint since ) const noexcept
+            {
+                auto it = std::lower_bound( ringBuffer.begin(), ringBuffer.end(), since,
+                                            []( const Entry & e, TimePoint t ){ return e.time < t; } );
+                return Window{ it, ringBuffer.end() };
+            }
+
+            /**
+            * @brief The Get Last Operation
+            *
+            * This operation finds the entries recorded within a duration of a time point, inclusive.
+            *
+            * @param window The duration of interest (e.g., std::chrono::milliseconds{ 5 }).
+            * @param now The time point the duration extends back from. The default is the current time point of our clock.
+            *
+            * @return Returns a window over the entries recorded no earlier than now less the duration, oldest to newest.
+            */
+            [[nodiscard]] inline Window getLast( Duration window, TimePoint now = ClockT::now() ) const noexcept
+            {
+                return getSince( now - window );
+            }
+
+            /**
+            * @brief The Get Newest Operation
+            *
+            * @return Returns an optional holding a copy of the newest entry. It has no value if the history is empty.
+            */
+            [[nodiscard]] std::optional< Entry > getNewest() const noexcept
+            {
+                const size_t n = ringBuffer.getAvailableCount();
+                return n ? ringBuffer.peek( n - 1 ) : std::nullopt;
+            }
+
+            /**
+            * @brief The Begin Operation
+            *
+            * @return Returns an iterator referring to the oldest entry.
+            */
+            [[nodiscard]] inline ConstIterator begin() const noexcept { return ringBuffer.begin(); }
+
+            /**
+            * @brief The End Operation
+            *
+            * @return Returns an iterator referring past the newest entry.
+            */
+            [[nodiscard]] inline ConstIterator end() const noexcept { return ringBuffer.end(); }
+
+            /**
+            * @brief The Get Available Count Operation
+            *
+            * @return Returns the number of entries recorded, up to the size of the history.
+            */
+            [[nodiscard]] inline size_t getAvailableCount() const noexcept { return ringBuffer.getAvailableCount(); }
+
+            /**
+            * @brief The Get Size Operation
+            *
+            * @return Returns the number of entries the history holds before the oldest are overwritten.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return ringBuffer.getSize(); }
+
+        private:
+            /**
+            * @brief Our Ring Buffer
+            *
+            * This is the ring buffer holding our entries, oldest to newest.
+            */
+            RingBufferType ringBuffer;
+
+            /**
+            * @brief The Newest Time Point
+            *
+            * This is the time point of the newest entry, retained to enforce non-decreasing time points.
+            */
+            TimePoint newestTime{};
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERHISTORY_HPP */
@@ -0,0 +1,674 @@
+/**
+* @file RingBufferJournal.hpp
+* @brief The Specification file for RingBufferJournal and RingBufferJournalReader
+*
+* This file came into existence to provide black-box recording of the last N records of a stream at memory speed,
+* in place of a write system call per record, with the records surviving a process restart for later replay.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERJOURNAL_HPP
+#define REISERRT_CORE_RINGBUFFERJOURNAL_HPP
+
+#include "ReiserRT_CoreExceptions.hpp"
+#include "RingBufferSizing.hpp"
+#include "RingBufferJournalFile.hpp"
+
+#include <atomic>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief Implementation class for RingBufferJournal and RingBufferJournalReader
+        *
+        * This template class provides an overwrite-oldest circular buffer whose header and elements reside in a
+        * caller provided region of memory, typically a memory mapped file (@see RingBufferJournalFile). The region
+        * holds no pointers, so it may be reopened at a different address by a later process. The header records a
+        * format version, the element size and the capacity, so that a reopened region may be validated, as well as
+        * the tail and put counters. These counters are 64 bits wide so that they never wrap over the life of a journal.
+        *
+        * Records in the range [tailCount, putCount) are valid. A put first advances the tailCount past the slot it is
+        * about to overwrite, then writes the slot and then advances the putCount. Should the writer die part way
+        * through a put, the partially written slot is therefore outside the valid range. A reader of a live journal
+        * re-checks the tailCount after copying a record and discards the copy if the slot was overwritten meanwhile.
+        *
+        * @warning Only one thread, in any process, may invoke put operations.
+        *
+        * @tparam ElementType The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line. Pointers are not supported as they
+        * are meaningless in another process.
+        */
+        template< typename ElementType >
+        class RingBufferJournalImple
+        {
+        private:
+            // ElementType must be trivially copyable for rapid load and store operations, default constructible,
+            // non-constant as put requires a write, and no larger than a cache line.
+            static_assert( RingBufferElementTraits< ElementType >::isSupported,
+                    "RingBufferJournalImple<ElementType> must specify a non-const, trivially copyable type no larger than a cache line!" );
+
+            // Pointers are only meaningful within the process that put them.
+            static_assert( !std::is_pointer< ElementType >::value,
+                    "RingBufferJournalImple<ElementType> must not specify a pointer type!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< ElementType >::ParamType;
+
+            /**
+            * @brief Ring Buffer Sizing Type
+            *
+            * This type provides the power of two sizing logic shared by all RingBuffer implementations.
+            * A 64bit counter type is specified so that counters persisted in the header never wrap.
+            */
+            using Sizing = RingBufferSizing< uint64_t >;
+
+            /**
+            * @brief Ring Buffer 64bit Counter Type
+            *
+            * This counter type is used to track tail and put indices.
+            */
+            using CounterType = Sizing::CounterType;
+
+            /**
+            * @brief Atomic Counter Type
+            *
+            * The tail and put counters may be observed by a reader in another process and must be atomic.
+            */
+            using AtomicCounterType = std::atomic< CounterType >;
+
+            // Our atomic counter type must be lock-free, or it cannot be shared between processes.
+            static_assert( AtomicCounterType::is_always_lock_free,
+                    "RingBufferJournalImple requires a lock-free atomic counter type!" );
+
+            /**
+            * @brief The Journal Header
+            *
+            * This structure resides at the start of the region. It describes the journal, so that it may be
+            * validated when reopened, and holds the tail and put counters. Both counters are only written by the
+            * one writer and so share a cache line. Elements follow at elementsOffset bytes from the start of the header.
+            */
+            struct Header
+            {
+                std::atomic< uint32_t > magic;                                  //!< Identifies an initialized header.
+                uint32_t formatVersion;                                         //!< The version of this layout.
+                uint32_t elementSize;                                           //!< The size of the element type.
+                uint32_t numBits;                                               //!< The number of bits indexing the element buffer.
+                uint32_t elementsOffset;                                        //!< The offset of the element buffer.
+                alignas( ringBufferCacheLineSize ) AtomicCounterType tailCount; //!< The count of the oldest valid record.
+                AtomicCounterType putCount;                                     //!< The number of records put.
+            };
+
+            /**
+            * @brief The Header Magic Number
+            *
+            * This value identifies an initialized header.
+            */
+            static constexpr uint32_t headerMagic = 0x52424A4E;
+
+            /**
+            * @brief The Format Version
+            *
+            * This value is to be incremented with any change to the header or element layout.
+            */
+            static constexpr uint32_t formatVersion = 1;
+
+            /**
+            * @brief Friend Declaration
+            *
+            * Template class RingBufferJournal is a friend and only it can invoked our member operations.
+            */
+            template< typename JT > friend class RingBufferJournal;
+
+            /**
+            * @brief Friend Declaration
+            *
+            * Template class RingBufferJournalReader is a friend and only it can invoked our member operations.
+            */
+            template< typename RT > friend class RingBufferJournalReader;
+
+        public:
+            /**
+            * @brief The Replay Function Type
+            *
+            * This is the type of functor invoked for each record replayed, oldest to newest.
+            */
+            using ReplayFunctionType = std::function< void( ParamType ) >;
+
+            /**
+            * @brief Get the Required Bytes Operation
+            *
+            * This operation calculates the size of the region required for a journal of requestedNumElements.
+            *
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the number of bytes is not representable by size_t.
+            *
+            * @return Returns the number of bytes required for the header and elements.
+            */
+            static constexpr size_t getRequiredBytes( size_t requestedNumElements )
+            {
+                return Sizing::numBytesForNE( Sizing::maskForNB( Sizing::numBitsForNE( requestedNumElements ) ) + 1,
+                                              sizeof( ElementType ), elementsOffset() );
+            }
+
+        protected:
+            /**
+            * @brief Writer Constructor for RingBufferJournalImple
+            *
+            * This constructor initializes a header at the start of a region if it has not been initialized. Otherwise,
+            * it validates the existing header, which must describe requestedNumElements of this element type, and
+            * resumes after its last record. The header is marked as initialized last, so that an interrupted
+            * initialization is simply repeated.
+            *
+            * @param pRegion A pointer to the region. It must be aligned to a cache line (as page aligned mappings are).
+            * @param regionBytes The size of the region. It must be at least getRequiredBytes( requestedNumElements ).
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region is misaligned, too small, or holds
+            * an incompatible journal.
+            */
+            RingBufferJournalImple( void * pRegion, size_t regionBytes, size_t requestedNumElements )
+                : pHeader{ validateRegion( pRegion, regionBytes, getRequiredBytes( requestedNumElements ) ) }
+            {
+                const CounterType numBits = Sizing::numBitsForNE( requestedNumElements );
+                if ( pHeader->magic.load( std::memory_order_acquire ) != headerMagic )
+                {
+                    new ( pHeader ) Header{};
+                    pHeader->formatVersion = formatVersion;
+                    pHeader->elementSize = uint32_t( sizeof( ElementType ) );
+                    pHeader->numBits = uint32_t( numBits );
+                    pHeader->elementsOffset = uint32_t( elementsOffset() );
+                    pHeader->tailCount.store( 0, std::memory_order_relaxed );
+                    pHeader->putCount.store( 0, std::memory_order_relaxed );
+
+                    // Publish the header as initialized.
+                    pHeader->magic.store( headerMagic, std::memory_order_release );
+                }
+                else if ( !isCompatible( regionBytes ) || pHeader->numBits != numBits )
+                {
+                    throw RingBufferStorageError{ "RingBufferJournalImple: Region holds an incompatible journal!" };
+                }
+                attach();
+            }
+
+            /**
+            * @brief Reader Constructor for RingBufferJournalImple
+            *
+            * This constructor validates a header previously initialized within a region, by the writer constructor,
+            * possibly in a process that no longer exists.
+            *
+            * @param pRegion A pointer to the region. Reader operations never write to it, so it may be mapped read only.
+            * @param regionBytes The size of the region.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region is misaligned, too small, or does not
+            * hold a compatible journal.
+            */
+            RingBufferJournalImple( const void * pRegion, size_t regionBytes )
+                : pHeader{ validateRegion( const_cast< void * >( pRegion ), regionBytes, sizeof( Header ) ) }
+            {
+                if ( pHeader->magic.load( std::memory_order_acquire ) != headerMagic || !isCompatible( regionBytes ) )
+                {
+                    throw RingBufferStorageError{ "RingBufferJournalImple: Region does not hold a compatible journal!" };
+                }
+                attach();
+            }
+
+            /**
+            * @brief Put an Element Into The RingBufferJournalImple
+            *
+            * This operation puts an element, overwriting the oldest if the journal is full. It never fails.
+            * It may only be invoked by the one writer thread.
+            *
+            * @param val The value to put.
+            */
+            void put( ParamType val ) noexcept
+            {
+                const CounterType currentPut = pHeader->putCount.load( std::memory_order_relaxed );
+                if ( currentPut >= numElements )
+                {
+                    // Retire the slot we are about to overwrite before we touch it.
+                    pHeader->tailCount.store( currentPut - numElements + 1, std::memory_order_relaxed );
+                    std::atomic_thread_fence( std::memory_order_release );
+                }
+                pElementBuf[ currentPut & numElementsMask ] = val;
+                pHeader->putCount.store( currentPut + 1, std::memory_order_release );
+            }
+
+            /**
+            * @brief Replay Records From The RingBufferJournalImple
+            *
+            * This operation invokes a functor with a copy of each valid record whose count is at least fromCount,
+            * oldest to newest. Records overwritten by a live writer while being copied are skipped.
+            *
+            * @param replayFunctor The functor to invoke with each record.
+            * @param fromCount The count of the first record of interest. Records older than the tailCount are gone.
+            *
+            * @return Returns the putCount observed, which may be passed as fromCount to replay only newer records.
+            */
+            CounterType replay( const ReplayFunctionType & replayFunctor, CounterType fromCount ) const
+            {
+                const CounterType currentPut = pHeader->putCount.load( std::memory_order_acquire );
+                CounterType i = pHeader->tailCount.load( std::memory_order_acquire );
+                if ( i < fromCount ) i = fromCount;
+                for ( ; i < currentPut; ++i )
+                {
+                    const ElementType val = pElementBuf[ i & numElementsMask ];
+                    std::atomic_thread_fence( std::memory_order_acquire );
+                    if ( pHeader->tailCount.load( std::memory_order_relaxed ) > i ) continue;
+                    replayFunctor( val );
+                }
+                return currentPut;
+            }
+
+            /**
+            * @brief Get the Put Count Operation
+            *
+            * @return Returns a snapshot of the number of records ever put to the journal.
+            */
+            [[nodiscard]] CounterType getPutCount() const noexcept
+            {
+                return pHeader->putCount.load( std::memory_order_acquire );
+            }
+
+            /**
+            * @brief Get the Available Count Operation
+            *
+            * @return Returns a snapshot of the number of valid records held by the journal.
+            */
+            [[nodiscard]] size_t getAvailableCount() const noexcept
+            {
+                const CounterType currentTail = pHeader->tailCount.load( std::memory_order_acquire );
+                return size_t( pHeader->putCount.load( std::memory_order_acquire ) - currentTail );
+            }
+
+            /**
+            * @brief Get the Number Of Elements Operation
+            *
+            * @return Returns the number of records that the journal holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return size_t( numElements ); }
+
+        private:
+            /**
+            * @brief The Elements Offset Operation
+            *
+            * @return Returns the offset from the header to the element buffer. The header size is
+            * a multiple of the cache line size due to the alignment of its counters.
+            */
+            static constexpr size_t elementsOffset() noexcept { return sizeof( Header ); }
+
+            /**
+            * @brief Validate Region Operation
+            *
+            * @param pRegion A pointer to the region.
+            * @param regionBytes The size of the region.
+            * @param requiredBytes The number of bytes required.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region is misaligned or too small.
+            *
+            * @return Returns a pointer to the header at the start of the region.
+            */
+            static Header * validateRegion( void * pRegion, size_t regionBytes, size_t requiredBytes )
+            {
+                if ( !pRegion || 0 != reinterpret_cast< uintptr_t >( pRegion ) % alignof( Header ) )
+                {
+                    throw RingBufferStorageError{ "RingBufferJournalImple: Region is not aligned to a cache line!" };
+                }
+                if ( regionBytes < requiredBytes )
+                {
+                    throw RingBufferStorageError{ "RingBufferJournalImple: Region is too small!" };
+                }
+                return static_cast< Header * >( pRegion );
+            }
+
+            /**
+            * @brief Is Compatible Operation
+            *
+            * @param regionBytes The size of the region.
+            *
+            * @return Returns true if an initialized header describes a journal of this format and element type
+            * that fits within the region, with counters that are consistent with its capacity.
+            */
+            bool isCompatible( size_t regionBytes ) const noexcept
+            {
+                if ( pHeader->formatVersion != formatVersion || pHeader->elementSize != sizeof( ElementType ) ||
+                     pHeader->elementsOffset != elementsOffset() || pHeader->numBits > Sizing::numBitsForNE( Sizing::maxElements ) ||
+                     regionBytes < elementsOffset() + ( size_t( sizeof( ElementType ) ) << pHeader->numBits ) )
+                {
+                    return false;
+                }
+                const CounterType currentTail = pHeader->tailCount.load( std::memory_order_relaxed );
+                const CounterType currentPut = pHeader->putCount.load( std::memory_order_relaxed );
+                return currentTail <= currentPut && currentPut - currentTail <= Sizing::maskForNB( pHeader->numBits ) + 1;
+            }
+
+            /**
+            * @brief Attach Operation
+            *
+            * This operation derives our process local attributes from the header.
+            */
+            void attach() noexcept
+            {
+                numElementsMask = Sizing::maskForNB( pHeader->numBits );
+                numElements = numElementsMask + 1;
+                pElementBuf = reinterpret_cast< ElementType * >( reinterpret_cast< char * >( pHeader ) + pHeader->elementsOffset );
+            }
+
+            /**
+            * @brief The Header
+            *
+            * A pointer to the header, as mapped into this process.
+            */
+            Header * const pHeader;
+
+            /**
+            * @brief The Element Buffer
+            *
+            * A pointer to the element buffer, as mapped into this process.
+            */
+            ElementType * pElementBuf{ nullptr };
+
+            /**
+            * @brief The Number of Elements Mask
+            *
+            * A process local copy of the mask to determine an index into an N element buffer.
+            */
+            CounterType numElementsMask{ 0 };
+
+            /**
+            * @brief The Number of Elements.
+            *
+            * A process local copy of the number of elements.
+            */
+            CounterType numElements{ 0 };
+        };
+
+        /**
+        * @brief RingBufferJournal Class
+        *
+        * This template class records the last N records of a stream in a memory mapped file. A put is a copy into
+        * memory and two counter stores. It never blocks, never fails and never enters the kernel; the operating
+        * system writes the file back in its own time. Records therefore survive the death or restart of the process.
+        * The sync operation may be invoked to also survive an operating system crash or power loss.
+        * Constructing a RingBufferJournal on an existing file resumes recording after its last record.
+        *
+        * @warning Only one thread, in any process, may invoke put operations on a given file.
+        *
+        * @tparam T The record type.
+        * @note Must be a trivially copyable, non-pointer type no larger than a cache line.
+        */
+        template< typename T >
+        class RingBufferJournal
+        {
+        private:
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
+
+        public:
+            /**
+            * @brief Get the Required Bytes Operation
+            *
+            * @param requestedNumElements The number of elements requested.
+            *
+            * @return Returns the size of the file for a journal of requestedNumElements.
+            */
+            static constexpr size_t getRequiredBytes( size_t requestedNumElements )
+            {
+                return RingBufferJournalImple< T >::getRequiredBytes( requestedNumElements );
+            }
+
+            /**
+            * @brief Constructor for RingBufferJournal
+            *
+            * This constructor creates a journal file, or reopens an existing journal file for further recording.
+            *
+            * @param path The path of the journal file.
+            * @param requestedNumElements The requested number of records. The actual size will be the next power of two.
+            * An existing journal file must have been created with the same number of records.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the file cannot be opened or mapped, or if an
+            * existing file does not hold a compatible journal.
+            */
+            RingBufferJournal( const char * path, size_t requestedNumElements )
+                : file{ path, getRequiredBytes( requestedNumElements ) }
+                , imple{ file.getData(), file.getNumBytes(), requestedNumElements }
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferJournal
+            *
+            * Copying RingBufferJournal is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferJournal of the same templated type.
+            */
+            RingBufferJournal( const RingBufferJournal & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferJournal
+            *
+            * Copy assignment of RingBufferJournal is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferJournal of the same templated type.
+            */
+            RingBufferJournal & operator =( const RingBufferJournal & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferJournal
+            *
+            * Moving RingBufferJournal is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferJournal of the same templated type.
+            */
+            RingBufferJournal( RingBufferJournal && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferJournal
+            *
+            * Move assignment of RingBufferJournal is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferJournal of the same templated type.
+            */
+            RingBufferJournal & operator =( RingBufferJournal && another ) = delete;
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation records an element of type T, overwriting the oldest record if the journal is full.
+            *
+            * @param val The value to put.
+            */
+            inline void put( ParamType val ) noexcept { imple.put( val ); }
+
+            /**
+            * @brief The Sync Operation
+            *
+            * This operation schedules the journal file to be written back to storage.
+            *
+            * @param wait If true, the operation does not return until the write back has completed.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the write back fails.
+            */
+            inline void sync( bool wait = false ) { file.sync( wait ); }
+
+            /**
+            * @brief The Get Put Count Operation
+            *
+            * @return Returns the number of records ever put to the journal, including those of earlier processes.
+            */
+            [[nodiscard]] inline uint64_t getPutCount() const noexcept { return imple.getPutCount(); }
+
+            /**
+            * @brief The Get Available Count Operation
+            *
+            * @return Returns the number of records held by the journal.
+            */
+            [[nodiscard]] inline size_t getAvailableCount() const noexcept { return imple.getAvailableCount(); }
+
+            /**
+            * @brief The Get Size Operation
+            *
+            * @return Returns the number of records the journal holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return imple.getSize(); }
+
+        private:
+            /**
+            * @brief Our Journal File
+            *
+            * This attribute is the memory mapped journal file. It must be declared before our implementation.
+            */
+            RingBufferJournalFile file;
+
+            /**
+            * @brief Our Implementation Instance
+            *
+            * This attribute is our process local implementation handle.
+            */
+            RingBufferJournalImple< T > imple;
+        };
+
+        /**
+        * @brief RingBufferJournalReader Class
+        *
+        * This template class opens a journal file, written by a RingBufferJournal, read only and replays its records
+        * oldest to newest. The writer may have exited, or may still be recording. In the latter case, replay may be
+        * invoked repeatedly, passing the count returned by the previous invocation, to follow the journal.
+        *
+        * @tparam T The record type. Must be the type the journal was written with.
+        */
+        template< typename T >
+        class RingBufferJournalReader
+        {
+        public:
+            /**
+            * @brief The Replay Function Type
+            *
+            * This is the type of functor invoked for each record replayed, oldest to newest.
+            */
+            using ReplayFunctionType = typename RingBufferJournalImple< T >::ReplayFunctionType;
+
+            /**
+            * @brief Constructor for RingBufferJournalReader
+            *
+            * This constructor opens an existing journal file read only and validates it.
+            *
+            * @param path The path of the journal file.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the file cannot be opened or mapped, or does not
+            * hold a compatible journal.
+            */
+            explicit RingBufferJournalReader( const char * path )
+                : file{ path }
+                , imple{ static_cast< const void * >( file.getData() ), file.getNumBytes() }
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferJournalReader
+            *
+            * Copying RingBufferJournalReader is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferJournalReader of the same templated type.
+            */
+            RingBufferJournalReader( const RingBufferJournalReader & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferJournalReader
+            *
+            * Copy assignment of RingBufferJournalReader is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferJournalReader of the same templated type.
+            */
+            RingBufferJournalReader & operator =( const RingBufferJournalReader & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferJournalReader
+            *
+            * Moving RingBufferJournalReader is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferJournalReader of the same templated type.
+            */
+            RingBufferJournalReader( RingBufferJournalReader && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferJournalReader
+            *
+            * Move assignment of RingBufferJournalReader is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferJournalReader of the same templated type.
+            */
+            RingBufferJournalReader & operator =( RingBufferJournalReader && another ) = delete;
+
+            /**
+            * @brief The Replay Operation
+            *
+            * This operation invokes a functor with each record held by the journal, oldest to newest.
+            *
+            * @param replayFunctor The functor to invoke with each record.
+            * @param fromCount Records put before this count are not replayed. The default replays all records held.
+            *
+            * @return Returns the put count observed, to be passed as fromCount to replay only records put since.
+            */
+            inline uint64_t replay( const ReplayFunctionType & replayFunctor, uint64_t fromCount = 0 ) const
+            {
+                return imple.replay( replayFunctor, fromCount );
+            }
+
+            /**
+            * @brief The Get Put Count Operation
+            *
+            * @return Returns a snapshot of the number of records ever put to the journal.
+            */
+            [[nodiscard]] inline uint64_t getPutCount() const noexcept { return imple.getPutCount(); }
+
+            /**
+            * @brief The Get Available Count Operation
+            *
+            * @return Returns a snapshot of the number of records held by the journal.
+            */
+            [[nodiscard]] inline size_t getAvailableCount() const noexcept { return imple.getAvailableCount(); }
+
+            /**
+            * @brief The Get Size Operation
+            *
+            * @return Returns the number of records the journal holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return imple.getSize(); }
+
+        private:
+            /**
+            * @brief Our Journal File
+            *
+            * This attribute is the read only memory mapped journal file. It must be declared before our implementation.
+            */
+            RingBufferJournalFile file;
+
+            /**
+            * @brief Our Implementation Instance
+            *
+            * This attribute is our process local implementation handle.
+            */
+            RingBufferJournalImple< T > imple;
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERJOURNAL_HPP */
@@ -0,0 +1,211 @@
+/**
+* @file RingBufferJournalFile.cpp
+* @brief The Implementation for RingBufferJournalFile
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "RingBufferJournalFile.hpp"
+
+#include "ReiserRT_CoreExceptions.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace ReiserRT::Core;
+
+/**
+* @brief The Implementation of RingBufferJournalFile
+*
+* This class provides the implementation specifics for the RingBufferJournalFile class. The file is opened,
+* sized if necessary, mapped shared and then closed, as the mapping holds its own reference.
+*/
+class RingBufferJournalFile::Imple
+{
+private:
+    /**
+    * @brief Friend Declaration
+    *
+    * Class RingBufferJournalFile is a friend and only it can invoke our member operations.
+    */
+    friend class RingBufferJournalFile;
+
+    /**
+    * @brief Qualified Constructor for Implementation
+    *
+    * @param path The path of the file.
+    * @param theNumBytes The number of bytes required when writable. Ignored when read only.
+    * @param writable True if the file is to be opened for writing and created if necessary.
+    *
+    * @throw Throws ReiserRT::Core::RingBufferStorageError if the file cannot be opened, sized or mapped,
+    * or if an existing writable file is of a different size.
+    */
+    Imple( const char * path, size_t theNumBytes, bool writable )
+        : numBytes{ theNumBytes }
+    {
+#ifdef __linux__
+        const int fd = writable ? open( path, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR | S_IRGRP ) :
+                                  open( path, O_RDONLY | O_CLOEXEC );
+        if ( -1 == fd ) throw RingBufferStorageError{ "RingBufferJournalFile::Imple: open failed!" };
+
+        struct stat st{};
+        const char * pError = nullptr;
+        if ( 0 != fstat( fd, &st ) )
+            pError = "RingBufferJournalFile::Imple: fstat failed!";
+        else if ( !writable )
+            numBytes = size_t( st.st_size );
+        else if ( 0 == st.st_size )
+        {
+            // A new file. Extending it zero fills it.
+            if ( 0 != ftruncate( fd, off_t( numBytes ) ) ) pError = "RingBufferJournalFile::Imple: ftruncate failed!";
+            created = true;
+        }
+        else if ( size_t( st.st_size ) != numBytes )
+            pError = "RingBufferJournalFile::Imple: Existing file is of a different size!";
+
+        if ( !pError && 0 == numBytes ) pError = "RingBufferJournalFile::Imple: File is empty!";
+
+        if ( !pError )
+        {
+            const int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+            void * p = mmap( nullptr, numBytes, prot, MAP_SHARED, fd, 0 );
+            if ( MAP_FAILED == p ) pError = "RingBufferJournalFile::Imple: mmap failed!";
+            else pData = p;
+        }
+        close( fd );
+
+        if ( pError ) throw RingBufferStorageError{ pError };
+#else
+        (void)path;
+        (void)writable;
+        throw RingBufferStorageError{ "RingBufferJournalFile::Imple: Not supported on this platform!" };
+#endif
+    }
+
+    /**
+    * @brief Destructor for the Implementation
+    *
+    * The destructor unmaps the file.
+    */
+    ~Imple()
+    {
+#ifdef __linux__
+        munmap( pData, numBytes );
+#endif
+    }
+
+    /**
+    * @brief Copy Constructor for Implementation
+    *
+    * Copying the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another Another instance of the implementation.
+    */
+    Imple( const Imple & another ) = delete;
+
+    /**
+    * @brief Copy Assignment Operation for Implementation
+    *
+    * Copying the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another Another instance of the implementation.
+    */
+    Imple & operator =( const Imple & another ) = delete;
+
+    /**
+    * @brief Move Constructor for Implementation
+    *
+    * Moving the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another An rvalue reference to another instance of the implementation.
+    */
+    Imple( Imple && another ) = delete;
+
+    /**
+    * @brief Move Assignment Operation for Implementation
+    *
+    * Moving the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another An rvalue reference to another instance of the implementation.
+    */
+    Imple & operator =( Imple && another ) = delete;
+
+    /**
+    * @brief The Sync Operation
+    *
+    * @param wait If true, use MS_SYNC. Otherwise, MS_ASYNC.
+    *
+    * @throw Throws ReiserRT::Core::RingBufferStorageError if msync fails.
+    */
+    void sync( bool wait )
+    {
+#ifdef __linux__
+        if ( 0 != msync( pData, numBytes, wait ? MS_SYNC : MS_ASYNC ) )
+        {
+            throw RingBufferStorageError{ "RingBufferJournalFile::Imple: msync failed!" };
+        }
+#else
+        (void)wait;
+#endif
+    }
+
+    /**
+    * @brief The Number of Bytes
+    *
+    * The number of bytes mapped.
+    */
+    size_t numBytes;
+
+    /**
+    * @brief The Data Pointer
+    *
+    * A pointer to the mapped file.
+    */
+    void * pData{ nullptr };
+
+    /**
+    * @brief The Created Flag
+    *
+    * True if the file was created (or was empty) and has been zero filled.
+    */
+    bool created{ false };
+};
+
+RingBufferJournalFile::RingBufferJournalFile( const char * path, size_t numBytes )
+    : pImple{ new Imple{ path, numBytes, true } }
+{
+}
+
+RingBufferJournalFile::RingBufferJournalFile( const char * path )
+    : pImple{ new Imple{ path, 0, false } }
+{
+}
+
+RingBufferJournalFile::~RingBufferJournalFile()
+{
+    delete pImple;
+}
+
+void * RingBufferJournalFile::getData() const noexcept
+{
+    return pImple->pData;
+}
+
+size_t RingBufferJournalFile::getNumBytes() const noexcept
+{
+    return pImple->numBytes;
+}
+
+bool RingBufferJournalFile::isCreated() const noexcept
+{
+    return pImple->created;
+}
+
+void RingBufferJournalFile::sync( bool wait )
+{
+    pImple->sync( wait );
+}
@@ -0,0 +1,155 @@
+/**
+* @file RingBufferJournalFile.hpp
+* @brief The Specification file for RingBufferJournalFile
+*
+* This file came into existence to provide RingBufferJournal with a memory mapped file, so that records
+* put at memory speed persist beyond the life of the process.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERJOURNALFILE_HPP
+#define REISERRT_CORE_RINGBUFFERJOURNALFILE_HPP
+
+#include "ReiserRT_CoreExport.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The RingBufferJournalFile Class
+        *
+        * This class maps a file into memory, shared, so that writes to memory are written back to the file by the
+        * operating system (presently, Linux only). A file may be opened for writing, in which case it is created
+        * if it does not exist, or opened read only. Writes reach the file even if the process subsequently crashes.
+        * The sync operation may be used to force them to storage, surviving an operating system crash or power loss.
+        */
+        class ReiserRT_Core_EXPORT RingBufferJournalFile
+        {
+        private:
+            /**
+            * @brief Forward Declaration of Hidden Implementation.
+            *
+            * The RingBufferJournalFile class hides its implementation details by employing the "pImple" idiom.
+            */
+            class Imple;
+
+        public:
+            /**
+            * @brief Writable Constructor for RingBufferJournalFile
+            *
+            * This constructor opens a file for reading and writing, creating it if necessary, and maps it.
+            * A file which is created, or which is empty, is sized to numBytes and zero filled. An existing file
+            * must already be numBytes in size.
+            *
+            * @param path The path of the file.
+            * @param numBytes The number of bytes required.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the file cannot be opened, sized or mapped,
+            * or if an existing file is of a different size.
+            */
+            RingBufferJournalFile( const char * path, size_t numBytes );
+
+            /**
+            * @brief Read Only Constructor for RingBufferJournalFile
+            *
+            * This constructor opens an existing file for reading only and maps it in its entirety.
+            *
+            * @param path The path of the file.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the file cannot be opened or mapped.
+            */
+            explicit RingBufferJournalFile( const char * path );
+
+            /**
+            * @brief Destructor for RingBufferJournalFile
+            *
+            * The destructor unmaps the file. Any writes not yet written back are still written back by the
+            * operating system.
+            */
+            ~RingBufferJournalFile();
+
+            /**
+            * @brief Copy Constructor for RingBufferJournalFile
+            *
+            * Copying RingBufferJournalFile is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferJournalFile.
+            */
+            RingBufferJournalFile( const RingBufferJournalFile & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferJournalFile
+            *
+            * Copy assignment of RingBufferJournalFile is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferJournalFile.
+            */
+            RingBufferJournalFile & operator =( const RingBufferJournalFile & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferJournalFile
+            *
+            * Moving RingBufferJournalFile is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferJournalFile.
+            */
+            RingBufferJournalFile( RingBufferJournalFile && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferJournalFile
+            *
+            * Move assignment of RingBufferJournalFile is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferJournalFile.
+            */
+            RingBufferJournalFile & operator =( RingBufferJournalFile && another ) = delete;
+
+            /**
+            * @brief The Get Data Operation
+            *
+            * @return Returns a pointer to the start of the mapped file.
+            */
+            void * getData() const noexcept;
+
+            /**
+            * @brief The Get Number of Bytes Operation
+            *
+            * @return Returns the number of bytes mapped.
+            */
+            size_t getNumBytes() const noexcept;
+
+            /**
+            * @brief The Is Created Operation
+            *
+            * @return Returns true if the file was created (or was empty) and has been zero filled by this instance.
+            */
+            bool isCreated() const noexcept;
+
+            /**
+            * @brief The Sync Operation
+            *
+            * This operation schedules the mapped file to be written back to storage (msync).
+            *
+            * @param wait If true, the operation does not return until the write back has completed.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the write back fails.
+            */
+            void sync( bool wait = false );
+
+        private:
+            /**
+            * @brief Pointer Member to Hidden Implementation
+            *
+            * This is our pointer to our hidden implementation.
+            */
+            Imple * pImple{ nullptr };
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERJOURNALFILE_HPP */
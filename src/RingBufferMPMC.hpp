@@ -0,0 +1,777 @@
+/**
+* @file RingBufferMPMC.hpp
+* @brief The Specification file for RingBufferMPMC
+*
+* This file came into existence to provide a bounded, lock-free ring buffer that may be shared by any number of
+* producer and consumer threads without the Mutex and condition variable that RingBufferGuarded employs on every
+* get and put operation, whether anyone is waiting or not.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERMPMC_HPP
+#define REISERRT_CORE_RINGBUFFERMPMC_HPP
+
+#include "ReiserRT_CoreExceptions.hpp"
+#include "RingBufferSizing.hpp"
+#include "RingBufferStorage.hpp"
+
+#include <atomic>
+#include <optional>
+#include <memory>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief Base implementation class for all RingBufferMPMC specializations
+        *
+        * This template class provides a bounded, lock-free, circular buffer for multiple producer threads and
+        * multiple consumer threads. It uses the same power of two sizing as RingBufferSimpleImple. Each element slot
+        * carries its own sequence number (after Dmitry Vyukov's bounded MPMC queue). A producer claims a slot by
+        * advancing the shared put counter with a compare and swap, only once the slot's sequence indicates that
+        * it has been consumed. It then stores its element and publishes it by advancing the slot's sequence.
+        * Consumers behave symmetrically with the shared get counter. No thread ever blocks in the kernel.
+        *
+        * @note This class does not block when empty or full. Operations either fail (try variants) or throw.
+        * Clients requiring blocking behavior should use RingBufferGuarded.
+        *
+        * @tparam ElementType The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float, void pointer,
+        * typed pointer or a small POD structure).
+        */
+        template< typename ElementType >
+        class RingBufferMPMCImple
+        {
+        private:
+            // ElementType must be trivially copyable for rapid load and store operations, default constructible,
+            // non-constant as put requires a write, and no larger than a cache line.
+            static_assert( RingBufferElementTraits< ElementType >::isSupported,
+                    "RingBufferMPMCImple<ElementType> must specify a non-const, trivially copyable type no larger than a cache line!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< ElementType >::ParamType;
+
+            /**
+            * @brief Ring Buffer Sizing Type
+            *
+            * This type provides the power of two sizing logic shared by all RingBuffer implementations.
+            */
+            using Sizing = RingBufferSizing<>;
+
+            /**
+            * @brief Ring Buffer 32bit Counter Type
+            *
+            * This counter type is used to track get and put indices as well as slot sequences.
+            */
+            using CounterType = Sizing::CounterType;
+
+            /**
+            * @brief Signed Difference Type
+            *
+            * The difference between a slot sequence and a counter is interpreted as signed to correctly
+            * handle counter roll-over.
+            */
+            using DifferenceType = typename std::make_signed< CounterType >::type;
+
+            /**
+            * @brief Atomic Counter Type
+            *
+            * The get and put counters and the slot sequences are shared between threads and must be atomic.
+            */
+            using AtomicCounterType = std::atomic< CounterType >;
+
+            // Our atomic counter type must be lock-free or there is no point to this class.
+            static_assert( AtomicCounterType::is_always_lock_free,
+                    "RingBufferMPMCImple requires a lock-free atomic counter type!" );
+
+            /**
+            * @brief The Slot Type
+            *
+            * Each slot of the element buffer pairs an element with its sequence number. A slot whose sequence
+            * equals the put counter is ready to be put into. A slot whose sequence equals the get counter plus one
+            * is ready to be got from.
+            */
+            struct Slot
+            {
+                /**
+                * @brief The Slot Sequence
+                *
+                * This attribute indicates the state of the slot relative to the put and get counters.
+                */
+                AtomicCounterType sequence;
+
+                /**
+                * @brief The Slot Value
+                *
+                * This attribute holds the element put into the slot.
+                */
+                ElementType value;
+            };
+
+            /**
+            * @brief Friend Declaration
+            *
+            * Template class RingBufferMPMCBase is a friend and only it can invoked our member operations.
+            */
+            template< typename ST > friend class RingBufferMPMCBase;
+
+        protected:
+            /**
+            * @brief Qualified Constructor for RingBufferMPMCImple
+            *
+            * This qualified constructor instantiates a RingBufferMPMCImple by first scrutinizing the
+            * requestedNumElements argument in the same manner as RingBufferSimpleImple. Once the actual number of
+            * elements to be allocated is determined, a buffer of slots is obtained as specified by the options and
+            * each slot's sequence is initialized to its index, marking it as ready to be put into.
+            *
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            * @param options The storage options (@see RingBufferStorageOptions).
+            * @note 2 is the minimum and Sizing::maxElements is the maximum. The requestedNumElements will be clamped to
+            * this range during construction.
+            */
+            explicit RingBufferMPMCImple( size_t requestedNumElements,
+                                          const RingBufferStorageOptions & options = RingBufferStorageOptions{} )
+                : putCount{ 0 }
+                , getCount{ 0 }
+                , numBits{ Sizing::numBitsForNE( requestedNumElements ) }
+                , numElementsMask{ Sizing::maskForNB( numBits ) }
+                , numElements{ numElementsMask + 1 }
+                , storage{ Sizing::numBytesForNE( numElements, sizeof( Slot ) ), alignof( Slot ), options }
+                , pSlotBuf{ static_cast< Slot * >( storage.getData() ) }
+            {
+                std::uninitialized_default_construct_n( pSlotBuf, numElements );
+                for ( CounterType i = 0; i != numElements; ++i )
+                    pSlotBuf[ i ].sequence.store( i, std::memory_order_relaxed );
+            }
+
+            /**
+            * @brief Destructor for RingBufferMPMCImple
+            *
+            * There is nothing to do. Slots are trivially destructible and our storage member returns the
+            * slot buffer to its source.
+            */
+            ~RingBufferMPMCImple() = default;
+
+            /**
+            * @brief Try to Put an Element Into The RingBufferMPMCImple
+            *
+            * This operation attempts to claim a slot for put and store an element into it.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the value was put and false if the ring buffer was full.
+            */
+            bool tryPut( ParamType val ) noexcept
+            {
+                Slot * pSlot;
+                CounterType put = putCount.load( std::memory_order_relaxed );
+                for (;;)
+                {
+                    pSlot = &pSlotBuf[ put & numElementsMask ];
+                    const CounterType seq = pSlot->sequence.load( std::memory_order_acquire );
+                    const auto diff = DifferenceType( seq - put );
+
+                    // If the slot is ready for put, attempt to claim it. On failure, put is refreshed for us.
+                    if ( diff == 0 )
+                    {
+                        if ( putCount.compare_exchange_weak( put, put + 1, std::memory_order_relaxed ) ) break;
+                    }
+                    // If the slot has not yet been consumed from the previous lap, we are full.
+                    else if ( diff < 0 )
+                        return false;
+                    // Else, another producer claimed it before us. Refresh and try again.
+                    else
+                        put = putCount.load( std::memory_order_relaxed );
+                }
+
+                // Store the value and publish it to consumers.
+                pSlot->value = val;
+                pSlot->sequence.store( put + 1, std::memory_order_release );
+                return true;
+            }
+
+            /**
+            * @brief Try to Get an Element From The RingBufferMPMCImple
+            *
+            * This operation attempts to claim a slot for get and retrieve the element from it.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if the ring buffer was empty.
+            */
+            std::optional< ElementType > tryGet() noexcept
+            {
+                Slot * pSlot;
+                CounterType get = getCount.load( std::memory_order_relaxed );
+                for (;;)
+                {
+                    pSlot = &pSlotBuf[ get & numElementsMask ];
+                    const CounterType seq = pSlot->sequence.load( std::memory_order_acquire );
+                    const auto diff = DifferenceType( seq - ( get + 1 ) );
+
+                    // If the slot has been published, attempt to claim it. On failure, get is refreshed for us.
+                    if ( diff == 0 )
+                    {
+                        if ( getCount.compare_exchange_weak( get, get + 1, std::memory_order_relaxed ) ) break;
+                    }
+                    // If the slot has not yet been published, we are empty.
+                    else if ( diff < 0 )
+                        return std::nullopt;
+                    // Else, another consumer claimed it before us. Refresh and try again.
+                    else
+                        get = getCount.load( std::memory_order_relaxed );
+                }
+
+                // Retrieve the value and release the slot to producers on their next lap.
+                std::optional< ElementType > retVal{ pSlot->value };
+                pSlot->sequence.store( get + numElements, std::memory_order_release );
+                return retVal;
+            }
+
+            /**
+            * @brief Get an Element From The RingBufferMPMCImple
+            *
+            * This operation attempts to get an element from the RingBufferMPMCImple.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there is no element available to fulfill the request.
+            *
+            * @return Returns an element from the RingBufferMPMCImple.
+            */
+            ElementType get()
+            {
+                auto val = tryGet();
+                if ( !val )
+                {
+                    throw RingBufferUnderflow{ "RingBufferMPMCImple::get() would result in underflow!" };
+                }
+                return *val;
+            }
+
+            /**
+            * @brief Put an Element Into The RingBufferMPMCImple
+            *
+            * This operation attempts to put an element into the RingBufferMPMCImple.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is no room left to fulfill the request.
+            *
+            * @param val The value to put.
+            */
+            void put( ParamType val )
+            {
+                if ( !tryPut( val ) )
+                {
+                    throw RingBufferOverflow{ "RingBufferMPMCImple::put() would result in overflow!" };
+                }
+            }
+
+            /**
+            * @brief Get the Number Of Bits Operation
+            *
+            * This operation is primarily useful in validation of the implementation. It returns the
+            * number of bits required to hold an index into an N element buffer.
+            *
+            * @return The number of bits required for a mask to determine an index into an N element buffer.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return numBits; }
+
+            /**
+            * @brief Get the Size Operation
+            *
+            * This operation returns the number of elements actually allocated during construction
+            * based on the requested number of elements.
+            *
+            * @return The number of elements that are available for put into a RingBufferMPMCImple from an empty state,
+            * or got from a RingBufferMPMCImple from a full state.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return numElements; }
+
+            /**
+            * @brief Get the Mask Operation
+            *
+            * This operation is primarily useful in validation of the implementation. It returns the
+            * mask that is used to internally to transparently manage roll-over of the RingBufferMPMCImple.
+            *
+            * @return The mask that is used internally to transparently manage roll-over of the RingBufferMPMCImple.
+            */
+            [[nodiscard]] inline size_t getMask() const noexcept { return numElementsMask; }
+
+        private:
+            /**
+            * @brief Our Put Count
+            *
+            * This attribute tracks the put counter shared by all producers. It occupies a cache line of its own.
+            */
+            alignas( ringBufferCacheLineSize ) AtomicCounterType putCount;
+
+            /**
+            * @brief Our Get Count
+            *
+            * This attribute tracks the get counter shared by all consumers. It occupies a cache line of its own.
+            */
+            alignas( ringBufferCacheLineSize ) AtomicCounterType getCount;
+
+            /**
+            * @brief The Number of Bits
+            *
+            * The number of bits required for a mask to determine an index into an N element buffer.
+            * The constant attributes start a cache line of their own which is only ever read after construction.
+            */
+            alignas( ringBufferCacheLineSize ) const CounterType numBits;
+
+            /**
+            * @brief The Number of Elements Mask
+            *
+            * The mask to determine an index into an N element buffer.
+            */
+            const CounterType numElementsMask;
+
+            /**
+            * @brief The Number of Elements.
+            *
+            * The number of elements that are available for put into RingBufferMPMCImple from an empty state,
+            * or got from a RingBufferMPMCImple from a full state.
+            */
+            const CounterType numElements;
+
+            /**
+            * @brief The Slot Storage.
+            *
+            * This object owns the memory backing our slot buffer.
+            */
+            RingBufferStorage storage;
+
+            /**
+            * @brief The Slot Buffer.
+            *
+            * This is the buffer space in where elements put into RingBufferMPMCImple are stored until subsequently
+            * retrieved, along with their sequence numbers.
+            */
+            Slot * const pSlotBuf;
+        };
+
+        /**
+        * @brief RingBufferMPMCBase Class
+        *
+        * This template class provides a base for more specialized types. It maintains the
+        * RingBufferMPMCImple of the same template argument type and provides access points to the
+        * RingBufferMPMCImple private operations as we are it's only friend.
+        *
+        * @note All constructors have to be public to be inherited as public with using declaration for derived classes.
+        *
+        * @tparam T The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float, void pointer,
+        * typed pointer or a small POD structure).
+        */
+        template< typename T >
+        class RingBufferMPMCBase
+        {
+        private:
+            // T must be trivially copyable and no larger than a cache line for rapid load and store operations.
+            // Larger types are supportable through a type pointer. See class ObjectPool within this namespace for such
+            // a use case.
+            static_assert( RingBufferElementTraits< T >::isSupported,
+                    "RingBufferMPMCBase< T > must specify a trivially copyable type no larger than a cache line!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
+
+        public:
+            /**
+            * @brief Qualified Constructor for RingBufferMPMCBase
+            *
+            * This is our qualified constructor for RingBufferMPMCBase. It instantiates the implementation,
+            * passing it the requestedNumElements and options arguments.
+            *
+            * @param requestedNumElements The requested number of elements for RingBufferMPMCBase.
+            * @param options The storage options. The default obtains slot storage from the standard heap.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if storage cannot be obtained as specified.
+            */
+            explicit RingBufferMPMCBase( size_t requestedNumElements,
+                                         const RingBufferStorageOptions & options = RingBufferStorageOptions{} )
+                : imple{ requestedNumElements, options }
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferMPMCBase
+            *
+            * Copying RingBufferMPMCBase is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferMPMCBase of the same templated type.
+            */
+            RingBufferMPMCBase( const RingBufferMPMCBase & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferMPMCBase
+            *
+            * Copying RingBufferMPMCBase is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferMPMCBase of the same templated type.
+            */
+            RingBufferMPMCBase & operator =( const RingBufferMPMCBase & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferMPMCBase
+            *
+            * Moving RingBufferMPMCBase is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferMPMCBase of the same templated type.
+            */
+            RingBufferMPMCBase( RingBufferMPMCBase && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferMPMCBase
+            *
+            * Moving RingBufferMPMCBase is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferMPMCBase of the same templated type.
+            */
+            RingBufferMPMCBase & operator =( RingBufferMPMCBase && another ) = delete;
+
+            /**
+            * @brief Destructor for RingBufferMPMCBase
+            *
+            * Default behavior for destructor of RingBufferMPMCBase is all that is required.
+            */
+            ~RingBufferMPMCBase() = default;
+
+        protected:
+            /**
+            * @brief The Get Operation
+            *
+            * This operation gets an element of type T from the implementation.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there is no element available to fulfill the request (empty).
+            *
+            * @return Returns type T, returned from the implementation.
+            */
+            inline T get() { return imple.get(); }
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation puts an element of type T into the implementation.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is no room left to fulfill the request (full).
+            */
+            inline void put( ParamType val ) { imple.put( val ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation attempts to get an element of type T from the implementation without throwing.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if the implementation was empty.
+            */
+            inline std::optional< T > tryGet() noexcept { return imple.tryGet(); }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation attempts to put an element of type T into the implementation without throwing.
+            *
+            * @return Returns true if the element was put and false if the implementation was full.
+            */
+            inline bool tryPut( ParamType val ) noexcept { return imple.tryPut( val ); }
+
+            /**
+            * @brief The Get Number of Bits Operation
+            *
+            * This operation returns the number of bits required by implementation.
+            * It is primarily a validation operation.
+            *
+            * @return Returns the number of bits required by the implementation's numElementsMask attribute.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return imple.getNumBits(); }
+
+            /**
+            * @brief The Get Size Operation.
+            *
+            * This operation returns the number of elements actually allocated during construction
+            * based on the requested number of elements.
+            *
+            * @return The number of elements that are available for put into RingBufferMPMCImple from an empty state,
+            * or got from a RingBufferMPMCImple from a full state.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return imple.getSize(); }
+
+            /**
+            * @brief The Get Mask Operation
+            *
+            * This operation returns the mask used to calculate indices by the implementation.
+            * It is primarily a validation operation.
+            *
+            * @return Returns the implementation's numElementsMask attribute.
+            */
+            [[nodiscard]] inline size_t getMask() const noexcept { return imple.getMask(); }
+
+        private:
+            /**
+            * @brief The Implementation
+            *
+            * This is our implementation object. It is simply aggregated. There is no need for another level of
+            * indirection. The implementation already has one level.
+            */
+            RingBufferMPMCImple< T > imple;
+        };
+
+        /**
+        * @brief RingBufferMPMC Class
+        *
+        * This template class provides a template for simple value types (not pointer types). It is derived from
+        * RingBufferMPMCBase of the same template argument type which own an implementation instance.
+        *
+        * @tparam T The ring buffer element type (not for pointer types).
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float or a small POD
+        * structure).
+        */
+        template< typename T >
+        class RingBufferMPMC : public RingBufferMPMCBase< T >
+        {
+        private:
+            /**
+            * @brief Alias Type to RingBufferMPMCBase< T >
+            *
+            * This type provides a little "syntactic sugar" for the class.
+            */
+            using Base = RingBufferMPMCBase< T >;
+
+        public:
+            /**
+            * @brief Inherit Constructors from Base Class
+            *
+            * We add no additional attributes. This declaration specifies that we
+            * want the Base version of constructors exposed as our own.
+            */
+            using Base::RingBufferMPMCBase;
+
+            /**
+            * @brief Inherit the Get Operation
+            *
+            * This declaration brings the get operation from our Base class into the public scope.
+            */
+            using Base::get;
+
+            /**
+            * @brief Inherit the Put Operation
+            *
+            * This declaration brings the put operation from our Base class into the public scope.
+            */
+            using Base::put;
+
+            /**
+            * @brief Inherit the Try Get Operation
+            *
+            * This declaration brings the tryGet operation from our Base class into the public scope.
+            */
+            using Base::tryGet;
+
+            /**
+            * @brief Inherit the Try Put Operation
+            *
+            * This declaration brings the tryPut operation from our Base class into the public scope.
+            */
+            using Base::tryPut;
+
+            /**
+            * @brief Inherit the Get Number of Bits Operation
+            *
+            * This declaration brings the getNumBits operation from our Base class into the public scope.
+            */
+            using Base::getNumBits;
+
+            /**
+            * @brief Inherit the Get Size Operation
+            *
+            * This declaration brings the getSize operation from our Base class into the public scope.
+            */
+            using Base::getSize;
+
+            /**
+            * @brief Inherit the Get Mask Operation
+            *
+            * This declaration brings the getMask operation from our Base class into the public scope.
+            */
+            using Base::getMask;
+        };
+
+        /**
+        * @brief Specialization of RingBufferMPMC for void Pointer Type
+        *
+        * This specialization of the RingBufferMPMCBase is specifically designed to handle void pointer
+        * type values. It was designed to handle a wide variety of concrete typed pointers
+        * that can transparently be cast back and forth with void pointers, thereby simplifying
+        * the type pointer template. It inherits directly from the RingBufferMPMCBase.
+        */
+        template<>
+        class RingBufferMPMC< void * > : public RingBufferMPMCBase< void * >
+        {
+        private:
+            /**
+            * @brief Alias Type to RingBufferMPMCBase< void * >
+            *
+            * This type provides a little "syntactic sugar" for the class.
+            */
+            using Base = RingBufferMPMCBase< void * >;
+
+        public:
+            /**
+            * @brief Inherit Constructors from Base Class
+            *
+            * We add no additional attributes. This declaration specifies that we
+            * want the Base version of constructors exposed as our own.
+            */
+            using Base::RingBufferMPMCBase;
+
+            /**
+            * @brief Inherit the Get Operation
+            *
+            * This declaration brings the get operation from our Base class into the public scope.
+            */
+            using Base::get;
+
+            /**
+            * @brief Inherit the Put Operation
+            *
+            * This declaration brings the put operation from our Base class into the public scope.
+            */
+            using Base::put;
+
+            /**
+            * @brief Inherit the Try Get Operation
+            *
+            * This declaration brings the tryGet operation from our Base class into the public scope.
+            */
+            using Base::tryGet;
+
+            /**
+            * @brief Inherit the Try Put Operation
+            *
+            * This declaration brings the tryPut operation from our Base class into the public scope.
+            */
+            using Base::tryPut;
+
+            /**
+            * @brief Inherit the Get Number of Bits Operation
+            *
+            * This declaration brings the getNumBits operation from our Base class into the public scope.
+            */
+            using Base::getNumBits;
+
+            /**
+            * @brief Inherit the Get Size Operation
+            *
+            * This declaration brings the getSize operation from our Base class into the public scope.
+            */
+            using Base::getSize;
+
+            /**
+            * @brief Inherit the Get Mask Operation
+            *
+            * This declaration brings the getMask operation from our Base class into the public scope.
+            */
+            using Base::getMask;
+        };
+
+        /**
+        * @brief A Partial Specialization for Concrete Type Pointers
+        *
+        * This partial specialization is provided for pointers to any type to be put into or retrieved from
+        * a RingBufferMPMC. It relies on its base class, RingBufferMPMC< void * >, for all but a cast to and fro.
+        */
+        template< typename T >
+        class RingBufferMPMC< T * > : public RingBufferMPMC< void * >
+        {
+        private:
+            /**
+            * @brief Alias Type to RingBufferMPMC< void * >
+            *
+            * This type provides a little "syntactic sugar" for the class.
+            */
+            using Base = RingBufferMPMC< void * >;
+
+            /**
+            * @brief Required Put Type
+            *
+            * Since the RingBufferMPMCImple cannot "put" into a constant buffer location because its internal
+            * representation is not constant. This causes problems when type T is constant. Any constant qualifier
+            * must be removed. Rest assured, the implementation will not mute any such data.
+            */
+            using PutType = typename std::remove_const<T>::type *;
+
+        public:
+            /**
+            * @brief Inherit Constructors from Base Class
+            *
+            * We add no additional attributes. This declaration specifies that we
+            * want the Base version of constructors exposed as our own.
+            */
+            using Base::RingBufferMPMC;
+
+            /**
+            * @brief The Get Operation
+            *
+            * This operation invokes the base class to retrieve a void pointer to the specified type
+            * from the base RingBufferMPMC.
+            * The value is compile time converted to a pointer of the specified template type. Thereby,
+            * adding no run-time penalty.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there is no element available to fulfill the request (empty).
+            *
+            * @return Returns a pointer to an object of type T retrieved from the implementation.
+            */
+            inline T * get() { return reinterpret_cast< T* >( Base::get() ); }
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation invokes the base class to put a typed pointer value into the base RingBufferMPMC.
+            * Any constant specification is removed and the typed pointer is implicitly converted to a
+            * void pointer at compile time yielding no run-time penalty.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is no room left to fulfill the request (full).
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            */
+            inline void put( T * p ) { Base::put( const_cast< PutType >( p ) ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation invokes the base class to try retrieving a void pointer to the specified type
+            * from the base RingBufferMPMC. Any value retrieved is converted to a pointer of the specified template type.
+            *
+            * @return Returns an optional holding a pointer to an object of type T. It has no value if the ring buffer was empty.
+            */
+            inline std::optional< T * > tryGet() noexcept
+            {
+                auto val = Base::tryGet();
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation invokes the base class to try putting a typed pointer value into the base RingBufferMPMC.
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            *
+            * @return Returns true if the pointer was put and false if the ring buffer was full.
+            */
+            inline bool tryPut( T * p ) noexcept { return Base::tryPut( const_cast< PutType >( p ) ); }
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERMPMC_HPP */
@@ -0,0 +1,611 @@
+/**
+* @file RingBufferMirrored.hpp
+* @brief The Specification file for RingBufferMirrored
+*
+* This file came into existence to allow sliding windows (e.g., FIR filter taps or parser look ahead) to be read
+* directly from a ring buffer as one contiguous span, even across the wrap point, without first copying the
+* wrapped tail into scratch memory.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERMIRRORED_HPP
+#define REISERRT_CORE_RINGBUFFERMIRRORED_HPP
+
+#include "ReiserRT_CoreExceptions.hpp"
+#include "RingBufferSizing.hpp"
+#include "RingBufferSpan.hpp"
+#include "RingBufferMirroredStorage.hpp"
+
+#include <optional>
+#include <memory>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief Implementation class for RingBufferMirrored
+        *
+        * This template class provides a circular buffer whose element storage is mapped twice, back to back,
+        * in virtual memory (@see RingBufferMirroredStorage). Element i may therefore be addressed as either
+        * pElementBuf[ i ] or pElementBuf[ i + numElements ], and any run of up to numElements elements is contiguous.
+        * It uses the same power of two sizing as RingBufferSimpleImple, further rounded up so that the element
+        * buffer is a whole number of pages. As with RingBufferSimpleImple, it is not thread safe.
+        *
+        * @tparam ElementType The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line, whose size is a power of two
+        * (e.g., char, int16_t, float, double or std::complex< float >).
+        */
+        template< typename ElementType >
+        class RingBufferMirroredImple
+        {
+        private:
+            // ElementType must be trivially copyable for rapid load and store operations, default constructible,
+            // non-constant as put requires a write, and no larger than a cache line.
+            static_assert( RingBufferElementTraits< ElementType >::isSupported,
+                    "RingBufferMirroredImple<ElementType> must specify a non-const, trivially copyable type no larger than a cache line!" );
+
+            // A power of two number of elements must fill a whole number of pages.
+            static_assert( ( sizeof( ElementType ) & ( sizeof( ElementType ) - 1 ) ) == 0,
+                    "RingBufferMirroredImple<ElementType> must specify a type whose size is a power of two!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< ElementType >::ParamType;
+
+            /**
+            * @brief Ring Buffer Sizing Type
+            *
+            * This type provides the power of two sizing logic shared by all RingBuffer implementations.
+            */
+            using Sizing = RingBufferSizing<>;
+
+            /**
+            * @brief Ring Buffer 32bit Counter Type
+            *
+            * This counter type is used to track get and put indices.
+            */
+            using CounterType = Sizing::CounterType;
+
+            /**
+            * @brief Friend Declaration
+            *
+            * Template class RingBufferMirrored is a friend and only it can invoked our member operations.
+            */
+            template< typename ST > friend class RingBufferMirrored;
+
+        protected:
+            /**
+            * @brief Qualified Constructor for RingBufferMirroredImple
+            *
+            * This qualified constructor instantiates a RingBufferMirroredImple by first scrutinizing the
+            * requestedNumElements argument in the same manner as RingBufferSimpleImple. The number of elements is
+            * then increased, if necessary, to fill at least one page. Once the actual number of elements is
+            * determined, mirrored storage is mapped.
+            *
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two,
+            * no less than a page worth of elements.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the mirrored storage cannot be mapped.
+            */
+            explicit RingBufferMirroredImple( size_t requestedNumElements )
+                : numBits{ numBitsForNE( requestedNumElements ) }
+                , numElementsMask{ Sizing::maskForNB( numBits ) }
+                , numElements{ numElementsMask + 1 }
+                , storage{ Sizing::numBytesForNE( numElements, sizeof( ElementType ) ) }
+                , pElementBuf{ static_cast< ElementType * >( storage.getData() ) }
+            {
+                // Begin the lifetime of our elements. For trivial types, this generates no code.
+                // The mirror addresses the very same elements.
+                std::uninitialized_default_construct_n( pElementBuf, numElements );
+            }
+
+            /**
+            * @brief Destructor for RingBufferMirroredImple
+            *
+            * There is nothing to do. Elements are trivially destructible and our storage member unmaps the
+            * element buffer.
+            */
+            ~RingBufferMirroredImple() = default;
+
+            /**
+            * @brief Get an Element From The RingBufferMirroredImple
+            *
+            * This operation attempts to get an element from the RingBufferMirroredImple and advance the getCount.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there is no element available to fulfill the request.
+            *
+            * @return Returns an element from the RingBufferMirroredImple.
+            */
+            ElementType get()
+            {
+                if ( getCount == putCount )
+                {
+                    throw RingBufferUnderflow{ "RingBufferMirroredImple::get() would result in underflow!" };
+                }
+                return pElementBuf[ getCount++ & numElementsMask ];
+            }
+
+            /**
+            * @brief Put an Element Into The RingBufferMirroredImple
+            *
+            * This operation attempts to put an element into the RingBufferMirroredImple and advance the putCount.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is no room to fulfill the request.
+            *
+            * @param val The value to put.
+            */
+            void put( ParamType val )
+            {
+                if ( CounterType( putCount - getCount ) == numElements )
+                {
+                    throw RingBufferOverflow{ "RingBufferMirroredImple::put() would result in overflow!" };
+                }
+                pElementBuf[ putCount++ & numElementsMask ] = val;
+            }
+
+            /**
+            * @brief Try to Get an Element From The RingBufferMirroredImple
+            *
+            * This operation attempts to get an element from the RingBufferMirroredImple and advance the getCount.
+            * It does not throw when empty. It reports it.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if empty.
+            */
+            std::optional< ElementType > tryGet() noexcept
+            {
+                if ( getCount == putCount ) return std::nullopt;
+                return pElementBuf[ getCount++ & numElementsMask ];
+            }
+
+            /**
+            * @brief Try to Put an Element Into The RingBufferMirroredImple
+            *
+            * This operation attempts to put an element into the RingBufferMirroredImple and advance the putCount.
+            * It does not throw when full. It reports it.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the value was put and false if full.
+            */
+            bool tryPut( ParamType val ) noexcept
+            {
+                if ( CounterType( putCount - getCount ) == numElements ) return false;
+                pElementBuf[ putCount++ & numElementsMask ] = val;
+                return true;
+            }
+
+            /**
+            * @brief Get Multiple Elements From The RingBufferMirroredImple
+            *
+            * This operation attempts to get n elements and advance the getCount by n. Thanks to the mirror,
+            * the elements are copied in one contiguous segment. Either all n elements are retrieved or none are.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available.
+            *
+            * @param pDst A pointer to a destination buffer with room for at least n elements.
+            * @param n The number of elements to get.
+            */
+            void get( ElementType * pDst, size_t n )
+            {
+                if ( n > CounterType( putCount - getCount ) )
+                {
+                    throw RingBufferUnderflow{ "RingBufferMirroredImple::get(n) would result in underflow!" };
+                }
+                std::memcpy( pDst, pElementBuf + ( getCount & numElementsMask ), n * sizeof( ElementType ) );
+                getCount += CounterType( n );
+            }
+
+            /**
+            * @brief Put Multiple Elements Into The RingBufferMirroredImple
+            *
+            * This operation attempts to put n elements and advance the putCount by n. Thanks to the mirror,
+            * the elements are copied in one contiguous segment. Either all n elements are put or none are.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is not room for n elements.
+            *
+            * @param pSrc A pointer to a source buffer of at least n elements.
+            * @param n The number of elements to put.
+            */
+            void put( const ElementType * pSrc, size_t n )
+            {
+                if ( n > numElements - CounterType( putCount - getCount ) )
+                {
+                    throw RingBufferOverflow{ "RingBufferMirroredImple::put(n) would result in overflow!" };
+                }
+                std::memcpy( pElementBuf + ( putCount & numElementsMask ), pSrc, n * sizeof( ElementType ) );
+                putCount += CounterType( n );
+            }
+
+            /**
+            * @brief Reserve Contiguous Elements for Put In Place
+            *
+            * This operation is the first phase of a zero-copy put. It returns a span of up to n contiguous element
+            * slots that may be written in place. Unlike RingBufferSimple, the span is only limited by the room available,
+            * never by the wrap point. Nothing is published until the commit operation is invoked.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous, writable element slots.
+            */
+            RingBufferSpan< ElementType > reserve( size_t n ) noexcept
+            {
+                const size_t room = numElements - CounterType( putCount - getCount );
+                if ( n > room ) n = room;
+                return { pElementBuf + ( putCount & numElementsMask ), n };
+            }
+
+            /**
+            * @brief Commit Elements Previously Reserved
+            *
+            * This operation is the second phase of a zero-copy put. It advances the putCount by n.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is not room for n elements.
+            *
+            * @param n The number of elements to publish. This should not exceed the size of the reserved span.
+            */
+            void commit( size_t n )
+            {
+                if ( n > numElements - CounterType( putCount - getCount ) )
+                {
+                    throw RingBufferOverflow{ "RingBufferMirroredImple::commit(n) would result in overflow!" };
+                }
+                putCount += CounterType( n );
+            }
+
+            /**
+            * @brief Peek at Contiguous Elements for Get In Place
+            *
+            * This operation is the first phase of a zero-copy get. It returns a span of up to n contiguous elements,
+            * oldest first, that may be read in place. Unlike RingBufferSimple, the span is only limited by the elements
+            * available, never by the wrap point. A sliding window is consumed by peeking the window length and
+            * releasing the hop length. Nothing is consumed until the release operation is invoked.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous elements.
+            */
+            RingBufferSpan< ElementType > peekSpan( size_t n ) noexcept
+            {
+                const size_t available = CounterType( putCount - getCount );
+                if ( n > available ) n = available;
+                return { pElementBuf + ( getCount & numElementsMask ), n };
+            }
+
+            /**
+            * @brief Release Elements Previously Peeked
+            *
+            * This operation is the second phase of a zero-copy get. It advances the getCount by n.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available.
+            *
+            * @param n The number of elements to consume.
+            */
+            void release( size_t n )
+            {
+                if ( n > CounterType( putCount - getCount ) )
+                {
+                    throw RingBufferUnderflow{ "RingBufferMirroredImple::release(n) would result in underflow!" };
+                }
+                getCount += CounterType( n );
+            }
+
+            /**
+            * @brief Get the Number Of Bits Operation
+            *
+            * @return Returns the number of bits used to mask a counter into an index.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return numBits; }
+
+            /**
+            * @brief Get the Number Of Elements Operation
+            *
+            * @return Returns the number of elements that the ring buffer holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return numElements; }
+
+            /**
+            * @brief Get the Mask Operation
+            *
+            * @return Returns the mask used to filter a counter to an index.
+            */
+            [[nodiscard]] inline size_t getMask() const noexcept { return numElementsMask; }
+
+            /**
+            * @brief Get the Available Count Operation
+            *
+            * @return Returns the number of elements available to get.
+            */
+            [[nodiscard]] inline size_t getAvailableCount() const noexcept { return CounterType( putCount - getCount ); }
+
+        private:
+            /**
+            * @brief Calculate the number of bits required for a mirrored ring buffer
+            *
+            * This operation increases the requested number of elements to at least a page worth before applying
+            * the power of two sizing logic. As both the page size and our element size are powers of two, the
+            * resulting element buffer is always a whole number of pages.
+            *
+            * @param requestedNumElements The number of elements requested.
+            *
+            * @return Returns the number of bits required to index the adjusted number of elements.
+            */
+            static CounterType numBitsForNE( size_t requestedNumElements )
+            {
+                const size_t pageElements = RingBufferMirroredStorage::getPageSize() / sizeof( ElementType );
+                return Sizing::numBitsForNE( requestedNumElements < pageElements ? pageElements : requestedNumElements );
+            }
+
+            /**
+            * @brief The Get Count
+            *
+            * This attribute counts elements got. It is filtered to an index with our mask.
+            */
+            CounterType getCount{ 0 };
+
+            /**
+            * @brief The Put Count
+            *
+            * This attribute counts elements put. It is filtered to an index with our mask.
+            */
+            CounterType putCount{ 0 };
+
+            /**
+            * @brief The Number of Bits
+            *
+            * The number of bits required for a mask to determine an index into an N element buffer.
+            */
+            const CounterType numBits;
+
+            /**
+            * @brief The Number of Elements Mask
+            *
+            * The mask to determine an index into an N element buffer.
+            */
+            const CounterType numElementsMask;
+
+            /**
+            * @brief The Number of Elements.
+            *
+            * The number of elements that are available for put from an empty state, or got from a full state.
+            */
+            const CounterType numElements;
+
+            /**
+            * @brief The Element Storage.
+            *
+            * This object owns the mirrored mappings backing our element buffer.
+            */
+            RingBufferMirroredStorage storage;
+
+            /**
+            * @brief The Element Buffer.
+            *
+            * This is the first of two mappings of the element buffer. The second immediately follows.
+            */
+            ElementType * const pElementBuf;
+        };
+
+        /**
+        * @brief RingBufferMirrored Class
+        *
+        * This template class provides a ring buffer whose element storage is mapped twice, back to back, in virtual
+        * memory. Any window of up to getSize() elements may be read (peekSpan) or written (reserve) as one contiguous
+        * span, even across the wrap point. This suits sliding window consumers, such as FIR filters, whose inner
+        * loops are best left free of wrap handling. As with RingBufferSimple, it is not thread safe.
+        *
+        * @tparam T The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line, whose size is a power of two.
+        */
+        template< typename T >
+        class RingBufferMirrored
+        {
+        private:
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
+
+        public:
+            /**
+            * @brief Qualified Constructor for RingBufferMirrored
+            *
+            * This is our qualified constructor for RingBufferMirrored. It instantiates the implementation,
+            * passing it the requestedNumElements argument.
+            *
+            * @param requestedNumElements The requested number of elements. The actual size will be the next power
+            * of two, no less than a page worth of elements.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the mirrored storage cannot be mapped.
+            */
+            explicit RingBufferMirrored( size_t requestedNumElements ) : imple{ requestedNumElements }
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferMirrored
+            *
+            * Copying RingBufferMirrored is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferMirrored of the same templated type.
+            */
+            RingBufferMirrored( const RingBufferMirrored & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferMirrored
+            *
+            * Copy assignment of RingBufferMirrored is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferMirrored of the same templated type.
+            */
+            RingBufferMirrored & operator =( const RingBufferMirrored & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferMirrored
+            *
+            * Moving RingBufferMirrored is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferMirrored of the same templated type.
+            */
+            RingBufferMirrored( RingBufferMirrored && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferMirrored
+            *
+            * Move assignment of RingBufferMirrored is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferMirrored of the same templated type.
+            */
+            RingBufferMirrored & operator =( RingBufferMirrored && another ) = delete;
+
+            /**
+            * @brief The Get Operation
+            *
+            * This operation gets an element of type T from the implementation.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if empty.
+            *
+            * @return Returns an element of type T.
+            */
+            inline T get() { return imple.get(); }
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation puts an element of type T into the implementation.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if full.
+            *
+            * @param val The value to put.
+            */
+            inline void put( ParamType val ) { imple.put( val ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation attempts to get an element of type T from the implementation without throwing.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if empty.
+            */
+            inline std::optional< T > tryGet() noexcept { return imple.tryGet(); }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation attempts to put an element of type T into the implementation without throwing.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the element was put and false if full.
+            */
+            inline bool tryPut( ParamType val ) noexcept { return imple.tryPut( val ); }
+
+            /**
+            * @brief The Bulk Get Operation
+            *
+            * This operation gets n elements of type T into a destination buffer with a single copy.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available.
+            *
+            * @param pDst A pointer to a destination buffer with room for at least n elements.
+            * @param n The number of elements to get.
+            */
+            inline void get( T * pDst, size_t n ) { imple.get( pDst, n ); }
+
+            /**
+            * @brief The Bulk Put Operation
+            *
+            * This operation puts n elements of type T from a source buffer with a single copy.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is not room for n elements.
+            *
+            * @param pSrc A pointer to a source buffer of at least n elements.
+            * @param n The number of elements to put.
+            */
+            inline void put( const T * pSrc, size_t n ) { imple.put( pSrc, n ); }
+
+            /**
+            * @brief The Reserve Operation
+            *
+            * This operation returns a span of up to n contiguous, writable element slots, limited only by the room
+            * available. @see RingBufferMirroredImple::reserve.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous, writable element slots.
+            */
+            inline RingBufferSpan< T > reserve( size_t n ) noexcept { return imple.reserve( n ); }
+
+            /**
+            * @brief The Commit Operation
+            *
+            * This operation publishes n elements previously reserved.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is not room for n elements.
+            *
+            * @param n The number of elements to publish.
+            */
+            inline void commit( size_t n ) { imple.commit( n ); }
+
+            /**
+            * @brief The Peek Span Operation
+            *
+            * This operation returns a span of up to n contiguous elements, oldest first, limited only by the elements
+            * available. @see RingBufferMirroredImple::peekSpan.
+            *
+            * @param n The number of elements desired (e.g., a window length).
+            *
+            * @return Returns a span of up to n contiguous elements.
+            */
+            inline RingBufferSpan< T > peekSpan( size_t n ) noexcept { return imple.peekSpan( n ); }
+
+            /**
+            * @brief The Release Operation
+            *
+            * This operation consumes n elements (e.g., a hop length).
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available.
+            *
+            * @param n The number of elements to consume.
+            */
+            inline void release( size_t n ) { imple.release( n ); }
+
+            /**
+            * @brief The Get Number of Bits Operation
+            *
+            * @return Returns the number of bits used to mask a counter into an index.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return imple.getNumBits(); }
+
+            /**
+            * @brief The Get Size Operation
+            *
+            * @return Returns the number of elements the ring buffer holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return imple.getSize(); }
+
+            /**
+            * @brief The Get Mask Operation
+            *
+            * @return Returns the mask used to filter a counter to an index.
+            */
+            [[nodiscard]] inline size_t getMask() const noexcept { return imple.getMask(); }
+
+            /**
+            * @brief The Get Available Count Operation
+            *
+            * @return Returns the number of elements available to get.
+            */
+            [[nodiscard]] inline size_t getAvailableCount() const noexcept { return imple.getAvailableCount(); }
+
+        private:
+            /**
+            * @brief Our Implementation Instance
+            *
+            * This attribute is our implementation.
+            */
+            RingBufferMirroredImple< T > imple;
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERMIRRORED_HPP */
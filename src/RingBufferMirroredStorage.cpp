@@ -0,0 +1,179 @@
+/**
+* @file RingBufferMirroredStorage.cpp
+* @brief The Implementation for RingBufferMirroredStorage
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "RingBufferMirroredStorage.hpp"
+
+#include "ReiserRT_CoreExceptions.hpp"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace ReiserRT::Core;
+
+/**
+* @brief The Implementation of RingBufferMirroredStorage
+*
+* This class provides the implementation specifics for the RingBufferMirroredStorage class. A region of twice
+* the requested size is first reserved with no access. An anonymous memory file of the requested size is then
+* mapped over each half of that region. The file descriptor is closed once mapped, as the mappings keep the
+* file alive.
+*/
+class RingBufferMirroredStorage::Imple
+{
+private:
+    /**
+    * @brief Friend Declaration
+    *
+    * Class RingBufferMirroredStorage is a friend and only it can invoke our member operations.
+    */
+    friend class RingBufferMirroredStorage;
+
+    /**
+    * @brief Qualified Constructor for Implementation
+    *
+    * This operation creates and maps the storage.
+    *
+    * @param theNumBytes The number of bytes required. This must be a non-zero multiple of the page size.
+    *
+    * @throw Throws ReiserRT::Core::RingBufferStorageError if storage cannot be created or mapped.
+    */
+    explicit Imple( size_t theNumBytes )
+        : numBytes{ theNumBytes }
+    {
+        if ( 0 == numBytes || 0 != numBytes % getPageSize() )
+        {
+            throw RingBufferStorageError{ "RingBufferMirroredStorage::Imple: Size must be a non-zero multiple of the page size!" };
+        }
+
+#ifdef __linux__
+        // Reserve a region of virtual memory large enough for both mappings.
+        void * p = mmap( nullptr, numBytes * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
+        if ( MAP_FAILED == p )
+        {
+            throw RingBufferStorageError{ "RingBufferMirroredStorage::Imple: mmap reservation failed!" };
+        }
+        pData = p;
+
+        // Create the memory file and map it over both halves of the reservation. Whether we succeed or not,
+        // we close the file descriptor. The mappings hold their own reference to the file.
+        const int fd = memfd_create( "ReiserRT_RingBufferMirrored", MFD_CLOEXEC );
+        const char * pError = nullptr;
+        if ( -1 == fd )
+            pError = "RingBufferMirroredStorage::Imple: memfd_create failed!";
+        else if ( 0 != ftruncate( fd, off_t( numBytes ) ) )
+            pError = "RingBufferMirroredStorage::Imple: ftruncate failed!";
+        else if ( MAP_FAILED == mmap( pData, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0 ) ||
+                  MAP_FAILED == mmap( static_cast< char * >( pData ) + numBytes, numBytes,
+                                      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0 ) )
+            pError = "RingBufferMirroredStorage::Imple: mmap of mirror failed!";
+        if ( -1 != fd ) close( fd );
+
+        // Our destructor will not be invoked if we throw. Return the reservation before doing so.
+        if ( pError )
+        {
+            munmap( pData, numBytes * 2 );
+            throw RingBufferStorageError{ pError };
+        }
+#else
+        throw RingBufferStorageError{ "RingBufferMirroredStorage::Imple: Not supported on this platform!" };
+#endif
+    }
+
+    /**
+    * @brief Destructor for the Implementation
+    *
+    * The destructor unmaps both halves of the storage.
+    */
+    ~Imple()
+    {
+#ifdef __linux__
+        munmap( pData, numBytes * 2 );
+#endif
+    }
+
+    /**
+    * @brief Copy Constructor for Implementation
+    *
+    * Copying the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another Another instance of the implementation.
+    */
+    Imple( const Imple & another ) = delete;
+
+    /**
+    * @brief Copy Assignment Operation for Implementation
+    *
+    * Copying the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another Another instance of the implementation.
+    */
+    Imple & operator =( const Imple & another ) = delete;
+
+    /**
+    * @brief Move Constructor for Implementation
+    *
+    * Moving the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another An rvalue reference to another instance of the implementation.
+    */
+    Imple( Imple && another ) = delete;
+
+    /**
+    * @brief Move Assignment Operation for Implementation
+    *
+    * Moving the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another An rvalue reference to another instance of the implementation.
+    */
+    Imple & operator =( Imple && another ) = delete;
+
+    /**
+    * @brief The Number of Bytes
+    *
+    * The number of bytes in one of the two mappings.
+    */
+    const size_t numBytes;
+
+    /**
+    * @brief The Data Pointer
+    *
+    * A pointer to the first of the two mappings.
+    */
+    void * pData{ nullptr };
+};
+
+RingBufferMirroredStorage::RingBufferMirroredStorage( size_t numBytes )
+    : pImple{ new Imple{ numBytes } }
+{
+}
+
+RingBufferMirroredStorage::~RingBufferMirroredStorage()
+{
+    delete pImple;
+}
+
+void * RingBufferMirroredStorage::getData() const noexcept
+{
+    return pImple->pData;
+}
+
+size_t RingBufferMirroredStorage::getNumBytes() const noexcept
+{
+    return pImple->numBytes;
+}
+
+size_t RingBufferMirroredStorage::getPageSize() noexcept
+{
+#ifdef __linux__
+    static const size_t pageSize = size_t( sysconf( _SC_PAGESIZE ) );
+    return pageSize;
+#else
+    return 4096;
+#endif
+}
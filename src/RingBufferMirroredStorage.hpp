@@ -0,0 +1,131 @@
+/**
+* @file RingBufferMirroredStorage.hpp
+* @brief The Specification file for RingBufferMirroredStorage
+*
+* This file came into existence to provide RingBufferMirrored with storage that is mapped twice, back to back,
+* in virtual memory. Any window of up to the storage size, starting anywhere within the first mapping, is
+* then contiguous in virtual memory.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERMIRROREDSTORAGE_HPP
+#define REISERRT_CORE_RINGBUFFERMIRROREDSTORAGE_HPP
+
+#include "ReiserRT_CoreExport.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The RingBufferMirroredStorage Class
+        *
+        * This class provides raw storage of a given number of bytes which is mapped twice, back to back, in virtual
+        * memory. A write to byte i of the storage is visible at both getData() + i and getData() + getNumBytes() + i.
+        * The number of bytes must be a multiple of the page size. The storage is obtained from an anonymous memory
+        * file (memfd_create) which is mapped into a reserved region of twice the size (presently, Linux only).
+        * It owns the mappings and returns them upon destruction. It does not construct or destroy elements.
+        */
+        class ReiserRT_Core_EXPORT RingBufferMirroredStorage
+        {
+        private:
+            /**
+            * @brief Forward Declaration of Hidden Implementation.
+            *
+            * The RingBufferMirroredStorage class hides its implementation details by employing the "pImple" idiom.
+            */
+            class Imple;
+
+        public:
+            /**
+            * @brief Qualified Constructor for RingBufferMirroredStorage
+            *
+            * This qualified constructor creates and maps the storage.
+            *
+            * @param numBytes The number of bytes required. This must be a non-zero multiple of the page size.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if numBytes is not a non-zero multiple of the page
+            * size or the storage cannot be created or mapped.
+            */
+            explicit RingBufferMirroredStorage( size_t numBytes );
+
+            /**
+            * @brief Destructor for RingBufferMirroredStorage
+            *
+            * The destructor unmaps the storage, returning it to the operating system.
+            */
+            ~RingBufferMirroredStorage();
+
+            /**
+            * @brief Copy Constructor for RingBufferMirroredStorage
+            *
+            * Copying RingBufferMirroredStorage is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferMirroredStorage.
+            */
+            RingBufferMirroredStorage( const RingBufferMirroredStorage & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferMirroredStorage
+            *
+            * Copy assignment of RingBufferMirroredStorage is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferMirroredStorage.
+            */
+            RingBufferMirroredStorage & operator =( const RingBufferMirroredStorage & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferMirroredStorage
+            *
+            * Moving RingBufferMirroredStorage is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferMirroredStorage.
+            */
+            RingBufferMirroredStorage( RingBufferMirroredStorage && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferMirroredStorage
+            *
+            * Move assignment of RingBufferMirroredStorage is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferMirroredStorage.
+            */
+            RingBufferMirroredStorage & operator =( RingBufferMirroredStorage && another ) = delete;
+
+            /**
+            * @brief The Get Data Operation
+            *
+            * @return Returns a pointer to the start of the first of the two mappings.
+            */
+            void * getData() const noexcept;
+
+            /**
+            * @brief The Get Number of Bytes Operation
+            *
+            * @return Returns the number of bytes in one mapping. The mirror begins this many bytes beyond getData().
+            */
+            size_t getNumBytes() const noexcept;
+
+            /**
+            * @brief The Get Page Size Operation
+            *
+            * @return Returns the page size of the system. Storage sizes must be a multiple of this.
+            */
+            static size_t getPageSize() noexcept;
+
+        private:
+            /**
+            * @brief Pointer Member to Hidden Implementation
+            *
+            * This is our pointer to our hidden implementation.
+            */
+            Imple * pImple{ nullptr };
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERMIRROREDSTORAGE_HPP */
@@ -0,0 +1,71 @@
+/**
+* @file RingBufferPolicies.hpp
+* @brief The Specification file for RingBuffer Producer and Consumer Policies
+*
+* This file came into existence to allow a ring buffer to select, at compile time, the cheapest synchronization
+* that is correct for the number of threads putting into, and getting from, it.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERPOLICIES_HPP
+#define REISERRT_CORE_RINGBUFFERPOLICIES_HPP
+
+#include <type_traits>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The Single Producer Policy
+        *
+        * This tag specifies that exactly one thread invokes put operations.
+        */
+        struct SingleProducer {};
+
+        /**
+        * @brief The Multiple Producer Policy
+        *
+        * This tag specifies that any number of threads may invoke put operations.
+        */
+        struct MultiProducer {};
+
+        /**
+        * @brief The Single Consumer Policy
+        *
+        * This tag specifies that exactly one thread invokes get operations.
+        */
+        struct SingleConsumer {};
+
+        /**
+        * @brief The Multiple Consumer Policy
+        *
+        * This tag specifies that any number of threads may invoke get operations.
+        */
+        struct MultiConsumer {};
+
+        /**
+        * @brief Is Producer Policy Trait
+        *
+        * This trait is true for SingleProducer and MultiProducer only.
+        *
+        * @tparam P The type to test.
+        */
+        template< typename P >
+        constexpr bool isProducerPolicy = std::is_same_v< P, SingleProducer > || std::is_same_v< P, MultiProducer >;
+
+        /**
+        * @brief Is Consumer Policy Trait
+        *
+        * This trait is true for SingleConsumer and MultiConsumer only.
+        *
+        * @tparam C The type to test.
+        */
+        template< typename C >
+        constexpr bool isConsumerPolicy = std::is_same_v< C, SingleConsumer > || std::is_same_v< C, MultiConsumer >;
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERPOLICIES_HPP */
@@ -0,0 +1,964 @@
+/**
+* @file RingBufferSPSC.hpp
+* @brief The Specification file for RingBufferSPSC
+*
+* This file came into existence to provide a lock-free ring buffer for the very common case of exactly one
+* producer thread handing off elements to exactly one consumer thread, without the Mutex or Semaphore
+* that RingBufferSimple requires in order to be shared across threads.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERSPSC_HPP
+#define REISERRT_CORE_RINGBUFFERSPSC_HPP
+
+#include "ReiserRT_CoreExceptions.hpp"
+#include "RingBufferSizing.hpp"
+#include "RingBufferSpan.hpp"
+#include "RingBufferStorage.hpp"
+
+#include <atomic>
+#include <optional>
+#include <memory>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief Base implementation class for all RingBufferSPSC specializations
+        *
+        * This template class provides a lock-free, circular buffer for exactly one producer thread and exactly one
+        * consumer thread. It uses the same power of two sizing as RingBufferSimpleImple. The put and get counters
+        * are atomic and published with release semantics and observed with acquire semantics. Each counter lives on
+        * its own cache line, along with a cached copy of the opposing counter. The cached copy is only refreshed
+        * when it indicates a full (producer) or empty (consumer) condition, which keeps cache line "ping-pong"
+        * between the two threads to a minimum.
+        *
+        * @warning Only one thread may invoke put operations and only one thread may invoke get operations.
+        * Violating this requirement results in undefined behavior.
+        *
+        * @tparam ElementType The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float, void pointer,
+        * typed pointer or a small POD structure).
+        */
+        template< typename ElementType >
+        class RingBufferSPSCImple
+        {
+        private:
+            // ElementType must be trivially copyable for rapid load and store operations, default constructible,
+            // non-constant as put requires a write, and no larger than a cache line.
+            static_assert( RingBufferElementTraits< ElementType >::isSupported,
+                    "RingBufferSPSCImple<ElementType> must specify a non-const, trivially copyable type no larger than a cache line!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< ElementType >::ParamType;
+
+            /**
+            * @brief Ring Buffer Sizing Type
+            *
+            * This type provides the power of two sizing logic shared by all RingBuffer implementations.
+            */
+            using Sizing = RingBufferSizing<>;
+
+            /**
+            * @brief Ring Buffer 32bit Counter Type
+            *
+            * This counter type is used to track get and put indices.
+            */
+            using CounterType = Sizing::CounterType;
+
+            /**
+            * @brief Atomic Counter Type
+            *
+            * The get and put counters are shared between the producer and consumer threads and must be atomic.
+            */
+            using AtomicCounterType = std::atomic< CounterType >;
+
+            // Our atomic counter type must be lock-free or there is no point to this class.
+            static_assert( AtomicCounterType::is_always_lock_free,
+                    "RingBufferSPSCImple requires a lock-free atomic counter type!" );
+
+            /**
+            * @brief Friend Declaration
+            *
+            * Template class RingBufferSPSCBase is a friend and only it can invoked our member operations.
+            */
+            template< typename ST > friend class RingBufferSPSCBase;
+
+        protected:
+            /**
+            * @brief Qualified Constructor for RingBufferSPSCImple
+            *
+            * This qualified constructor instantiates a RingBufferSPSCImple by first scrutinizing the
+            * requestedNumElements argument in the same manner as RingBufferSimpleImple. Once the actual number of
+            * elements to be allocated is determined, a buffer for elements is obtained as specified by the options.
+            *
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            * @param options The storage options (@see RingBufferStorageOptions).
+            * @note 2 is the minimum and Sizing::maxElements is the maximum. The requestedNumElements will be clamped to
+            * this range during construction.
+            */
+            explicit RingBufferSPSCImple( size_t requestedNumElements,
+                                          const RingBufferStorageOptions & options = RingBufferStorageOptions{} )
+                : putCount{ 0 }
+                , cachedGetCount{ 0 }
+                , getCount{ 0 }
+                , cachedPutCount{ 0 }
+                , numBits{ Sizing::numBitsForNE( requestedNumElements ) }
+                , numElementsMask{ Sizing::maskForNB( numBits ) }
+                , numElements{ numElementsMask + 1 }
+                , storage{ Sizing::numBytesForNE( numElements, sizeof( ElementType ) ), alignof( ElementType ), options }
+                , pElementBuf{ static_cast< ElementType * >( storage.getData() ) }
+            {
+                // Begin the lifetime of our elements. For trivial types, this generates no code.
+                std::uninitialized_default_construct_n( pElementBuf, numElements );
+            }
+
+            /**
+            * @brief Destructor for RingBufferSPSCImple
+            *
+            * There is nothing to do. Elements are trivially destructible and our storage member returns the
+            * element buffer to its source.
+            */
+            ~RingBufferSPSCImple() = default;
+
+            /**
+            * @brief Try to Put an Element Into The RingBufferSPSCImple
+            *
+            * This operation attempts to put an element into the RingBufferSPSCImple and publish the new putCount.
+            * It may only be invoked by the one producer thread.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the value was put and false if the ring buffer was full.
+            */
+            bool tryPut( ParamType val ) noexcept
+            {
+                // Only we write the putCount, so a relaxed load is sufficient.
+                const CounterType put = putCount.load( std::memory_order_relaxed );
+
+                // If our cached get count indicates that we are full, refresh it from the consumer's
+                // get count and try again. Only then are we truly full.
+                if ( CounterType( put - cachedGetCount ) > numElementsMask )
+                {
+                    cachedGetCount = getCount.load( std::memory_order_acquire );
+                    if ( CounterType( put - cachedGetCount ) > numElementsMask ) return false;
+                }
+
+                // Store the value and then publish it to the consumer.
+                pElementBuf[ put & numElementsMask ] = val;
+                putCount.store( put + 1, std::memory_order_release );
+                return true;
+            }
+
+            /**
+            * @brief Try to Get an Element From The RingBufferSPSCImple
+            *
+            * This operation attempts to get an element from the RingBufferSPSCImple and publish the new getCount.
+            * It may only be invoked by the one consumer thread.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if the ring buffer was empty.
+            */
+            std::optional< ElementType > tryGet() noexcept
+            {
+                // Only we write the getCount, so a relaxed load is sufficient.
+                const CounterType get = getCount.load( std::memory_order_relaxed );
+
+                // If our cached put count indicates that we are empty, refresh it from the producer's
+                // put count and try again. Only then are we truly empty.
+                if ( get == cachedPutCount )
+                {
+                    cachedPutCount = putCount.load( std::memory_order_acquire );
+                    if ( get == cachedPutCount ) return std::nullopt;
+                }
+
+                // Fetch the value and then release the slot back to the producer.
+                std::optional< ElementType > retVal{ pElementBuf[ get & numElementsMask ] };
+                getCount.store( get + 1, std::memory_order_release );
+                return retVal;
+            }
+
+            /**
+            * @brief Get an Element From The RingBufferSPSCImple
+            *
+            * This operation attempts to get an element from the RingBufferSPSCImple and advance the getCount.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there is no element available to fulfill the request.
+            *
+            * @return Returns an element from the RingBufferSPSCImple.
+            */
+            ElementType get()
+            {
+                auto val = tryGet();
+                if ( !val )
+                {
+                    throw RingBufferUnderflow{ "RingBufferSPSCImple::get() would result in underflow!" };
+                }
+                return *val;
+            }
+
+            /**
+            * @brief Put an Element Into The RingBufferSPSCImple
+            *
+            * This operation attempts to put an element into the RingBufferSPSCImple and advance the putCount.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is no room left to fulfill the request.
+            *
+            * @param val The value to put.
+            */
+            void put( ParamType val )
+            {
+                if ( !tryPut( val ) )
+                {
+                    throw RingBufferOverflow{ "RingBufferSPSCImple::put() would result in overflow!" };
+                }
+            }
+
+            /**
+            * @brief Reserve Contiguous Elements for Put In Place
+            *
+            * This operation is the first phase of a zero-copy put. It returns a span of up to n contiguous element
+            * slots that may be written in place. The span is limited by the room available and by the point where the
+            * element buffer wraps around. It may therefore be shorter than requested or even empty. Nothing is
+            * published to the consumer until the commit operation is invoked. It may only be invoked by the one
+            * producer thread.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous, writable element slots.
+            */
+            RingBufferSpan< ElementType > reserve( size_t n ) noexcept
+            {
+                const CounterType put = putCount.load( std::memory_order_relaxed );
+
+                // Only refresh our cached get count if it indicates less room than desired.
+                size_t room = numElements - CounterType( put - cachedGetCount );
+                if ( n > room )
+                {
+                    cachedGetCount = getCount.load( std::memory_order_acquire );
+                    room = numElements - CounterType( put - cachedGetCount );
+                }
+
+                const CounterType first = put & numElementsMask;
+                const size_t contiguous = numElements - first;
+                if ( n > room ) n = room;
+                if ( n > contiguous ) n = contiguous;
+                return { pElementBuf + first, n };
+            }
+
+            /**
+            * @brief Commit Elements Previously Reserved
+            *
+            * This operation is the second phase of a zero-copy put. It publishes the first n elements of the span
+            * previously returned by the reserve operation to the consumer. It may only be invoked by the one
+            * producer thread.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is not room for n elements.
+            *
+            * @param n The number of elements to publish. This should not exceed the size of the reserved span.
+            */
+            void commit( size_t n )
+            {
+                const CounterType put = putCount.load( std::memory_order_relaxed );
+                if ( n > numElements - CounterType( put - cachedGetCount ) )
+                {
+                    cachedGetCount = getCount.load( std::memory_order_acquire );
+                    if ( n > numElements - CounterType( put - cachedGetCount ) )
+                    {
+                        throw RingBufferOverflow{ "RingBufferSPSCImple::commit(n) would result in overflow!" };
+                    }
+                }
+                putCount.store( put + CounterType( n ), std::memory_order_release );
+            }
+
+            /**
+            * @brief Peek at Contiguous Elements for Get In Place
+            *
+            * This operation is the first phase of a zero-copy get. It returns a span of up to n contiguous elements
+            * that may be read in place. The span is limited by the elements available and by the point where the
+            * element buffer wraps around. It may therefore be shorter than requested or even empty. Nothing is
+            * released to the producer until the release operation is invoked. It may only be invoked by the one
+            * consumer thread.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous elements.
+            */
+            RingBufferSpan< ElementType > peekSpan( size_t n ) noexcept
+            {
+                const CounterType get = getCount.load( std::memory_order_relaxed );
+
+                // Only refresh our cached put count if it indicates less available than desired.
+                size_t available = CounterType( cachedPutCount - get );
+                if ( n > available )
+                {
+                    cachedPutCount = putCount.load( std::memory_order_acquire );
+                    available = CounterType( cachedPutCount - get );
+                }
+
+                const CounterType first = get & numElementsMask;
+                const size_t contiguous = numElements - first;
+                if ( n > available ) n = available;
+                if ( n > contiguous ) n = contiguous;
+                return { pElementBuf + first, n };
+            }
+
+            /**
+            * @brief Release Elements Previously Peeked
+            *
+            * This operation is the second phase of a zero-copy get. It releases the first n elements of the span
+            * previously returned by the peekSpan operation back to the producer. It may only be invoked by the one
+            * consumer thread.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available.
+            *
+            * @param n The number of elements to consume. This should not exceed the size of the peeked span.
+            */
+            void release( size_t n )
+            {
+                const CounterType get = getCount.load( std::memory_order_relaxed );
+                if ( n > CounterType( cachedPutCount - get ) )
+                {
+                    cachedPutCount = putCount.load( std::memory_order_acquire );
+                    if ( n > CounterType( cachedPutCount - get ) )
+                    {
+                        throw RingBufferUnderflow{ "RingBufferSPSCImple::release(n) would result in underflow!" };
+                    }
+                }
+                getCount.store( get + CounterType( n ), std::memory_order_release );
+            }
+
+            /**
+            * @brief Get the Number Of Bits Operation
+            *
+            * This operation is primarily useful in validation of the implementation. It returns the
+            * number of bits required to hold an index into an N element buffer.
+            *
+            * @return The number of bits required for a mask to determine an index into an N element buffer.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return numBits; }
+
+            /**
+            * @brief Get the Size Operation
+            *
+            * This operation returns the number of elements actually allocated during construction
+            * based on the requested number of elements.
+            *
+            * @return The number of elements that are available for put into a RingBufferSPSCImple from an empty state,
+            * or got from a RingBufferSPSCImple from a full state.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return numElements; }
+
+            /**
+            * @brief Get the Mask Operation
+            *
+            * This operation is primarily useful in validation of the implementation. It returns the
+            * mask that is used to internally to transparently manage roll-over of the RingBufferSPSCImple.
+            *
+            * @return The mask that is used internally to transparently manage roll-over of the RingBufferSPSCImple.
+            */
+            [[nodiscard]] inline size_t getMask() const noexcept { return numElementsMask; }
+
+        private:
+            /**
+            * @brief Our Put Count
+            *
+            * This attribute tracks the put counter. It is written by the producer and read by the consumer.
+            * It starts a cache line of its own, shared only with the producer's cached get count.
+            */
+            alignas( ringBufferCacheLineSize ) AtomicCounterType putCount;
+
+            /**
+            * @brief The Producer's Cached Get Count
+            *
+            * This attribute is the producer's last observed value of the get counter. It is only accessed
+            * by the producer.
+            */
+            CounterType cachedGetCount;
+
+            /**
+            * @brief Our Get Count
+            *
+            * This attribute tracks the get counter. It is written by the consumer and read by the producer.
+            * It starts a cache line of its own, shared only with the consumer's cached put count.
+            */
+            alignas( ringBufferCacheLineSize ) AtomicCounterType getCount;
+
+            /**
+            * @brief The Consumer's Cached Put Count
+            *
+            * This attribute is the consumer's last observed value of the put counter. It is only accessed
+            * by the consumer.
+            */
+            CounterType cachedPutCount;
+
+            /**
+            * @brief The Number of Bits
+            *
+            * The number of bits required for a mask to determine an index into an N element buffer.
+            * The constant attributes start a cache line of their own which is only ever read after construction.
+            */
+            alignas( ringBufferCacheLineSize ) const CounterType numBits;
+
+            /**
+            * @brief The Number of Elements Mask
+            *
+            * The mask to determine an index into an N element buffer.
+            */
+            const CounterType numElementsMask;
+
+            /**
+            * @brief The Number of Elements.
+            *
+            * The number of elements that are available for put into RingBufferSPSCImple from an empty state,
+            * or got from a RingBufferSPSCImple from a full state.
+            */
+            const CounterType numElements;
+
+            /**
+            * @brief The Element Storage.
+            *
+            * This object owns the memory backing our element buffer.
+            */
+            RingBufferStorage storage;
+
+            /**
+            * @brief The Element Buffer.
+            *
+            * This is the buffer space in where elements put into RingBufferSPSCImple are stored until subsequently retrieved.
+            */
+            ElementType * const pElementBuf;
+        };
+
+        /**
+        * @brief RingBufferSPSCBase Class
+        *
+        * This template class provides a base for more specialized types. It maintains the
+        * RingBufferSPSCImple of the same template argument type and provides access points to the
+        * RingBufferSPSCImple private operations as we are it's only friend.
+        *
+        * @note All constructors have to be public to be inherited as public with using declaration for derived classes.
+        *
+        * @tparam T The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float, void pointer,
+        * typed pointer or a small POD structure).
+        */
+        template< typename T >
+        class RingBufferSPSCBase
+        {
+        private:
+            // T must be trivially copyable and no larger than a cache line for rapid load and store operations.
+            // Larger types are supportable through a type pointer. See class ObjectPool within this namespace for such
+            // a use case.
+            static_assert( RingBufferElementTraits< T >::isSupported,
+                    "RingBufferSPSCBase< T > must specify a trivially copyable type no larger than a cache line!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
+
+        public:
+            /**
+            * @brief Qualified Constructor for RingBufferSPSCBase
+            *
+            * This is our qualified constructor for RingBufferSPSCBase. It instantiates the implementation,
+            * passing it the requestedNumElements and options arguments.
+            *
+            * @param requestedNumElements The requested number of elements for RingBufferSPSCBase.
+            * @param options The storage options. The default obtains element storage from the standard heap.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if storage cannot be obtained as specified.
+            */
+            explicit RingBufferSPSCBase( size_t requestedNumElements,
+                                         const RingBufferStorageOptions & options = RingBufferStorageOptions{} )
+                : imple{ requestedNumElements, options }
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferSPSCBase
+            *
+            * Copying RingBufferSPSCBase is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferSPSCBase of the same templated type.
+            */
+            RingBufferSPSCBase( const RingBufferSPSCBase & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferSPSCBase
+            *
+            * Copying RingBufferSPSCBase is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferSPSCBase of the same templated type.
+            */
+            RingBufferSPSCBase & operator =( const RingBufferSPSCBase & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferSPSCBase
+            *
+            * Moving RingBufferSPSCBase is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferSPSCBase of the same templated type.
+            */
+            RingBufferSPSCBase( RingBufferSPSCBase && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferSPSCBase
+            *
+            * Moving RingBufferSPSCBase is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferSPSCBase of the same templated type.
+            */
+            RingBufferSPSCBase & operator =( RingBufferSPSCBase && another ) = delete;
+
+            /**
+            * @brief Destructor for RingBufferSPSCBase
+            *
+            * Default behavior for destructor of RingBufferSPSCBase is all that is required.
+            */
+            ~RingBufferSPSCBase() = default;
+
+        protected:
+            /**
+            * @brief The Get Operation
+            *
+            * This operation gets an element of type T from the implementation.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there is no element available to fulfill the request (empty).
+            *
+            * @return Returns type T, returned from the implementation.
+            */
+            inline T get() { return imple.get(); }
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation puts an element of type T into the implementation.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is no room left to fulfill the request (full).
+            */
+            inline void put( ParamType val ) { imple.put( val ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation attempts to get an element of type T from the implementation without throwing.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if the implementation was empty.
+            */
+            inline std::optional< T > tryGet() noexcept { return imple.tryGet(); }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation attempts to put an element of type T into the implementation without throwing.
+            *
+            * @return Returns true if the element was put and false if the implementation was full.
+            */
+            inline bool tryPut( ParamType val ) noexcept { return imple.tryPut( val ); }
+
+            /**
+            * @brief The Reserve Operation
+            *
+            * This operation reserves up to n contiguous element slots of the implementation to be written in place.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous, writable element slots.
+            */
+            inline RingBufferSpan< T > reserve( size_t n ) noexcept { return imple.reserve( n ); }
+
+            /**
+            * @brief The Commit Operation
+            *
+            * This operation publishes n previously reserved elements of the implementation.
+            *
+            * @param n The number of elements to publish.
+            */
+            inline void commit( size_t n ) { imple.commit( n ); }
+
+            /**
+            * @brief The Peek Span Operation
+            *
+            * This operation returns up to n contiguous elements of the implementation to be read in place.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous elements.
+            */
+            inline RingBufferSpan< T > peekSpan( size_t n ) noexcept { return imple.peekSpan( n ); }
+
+            /**
+            * @brief The Release Operation
+            *
+            * This operation consumes n previously peeked elements of the implementation.
+            *
+            * @param n The number of elements to consume.
+            */
+            inline void release( size_t n ) { imple.release( n ); }
+
+            /**
+            * @brief The Get Number of Bits Operation
+            *
+            * This operation returns the number of bits required by implementation.
+            * It is primarily a validation operation.
+            *
+            * @return Returns the number of bits required by the implementation's numElementsMask attribute.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return imple.getNumBits(); }
+
+            /**
+            * @brief The Get Size Operation.
+            *
+            * This operation returns the number of elements actually allocated during construction
+            * based on the requested number of elements.
+            *
+            * @return The number of elements that are available for put into RingBufferSPSCImple from an empty state,
+            * or got from a RingBufferSPSCImple from a full state.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return imple.getSize(); }
+
+            /**
+            * @brief The Get Mask Operation
+            *
+            * This operation returns the mask used to calculate indices by the implementation.
+            * It is primarily a validation operation.
+            *
+            * @return Returns the implementation's numElementsMask attribute.
+            */
+            [[nodiscard]] inline size_t getMask() const noexcept { return imple.getMask(); }
+
+        private:
+            /**
+            * @brief The Implementation
+            *
+            * This is our implementation object. It is simply aggregated. There is no need for another level of
+            * indirection. The implementation already has one level.
+            */
+            RingBufferSPSCImple< T > imple;
+        };
+
+        /**
+        * @brief RingBufferSPSC Class
+        *
+        * This template class provides a template for simple value types (not pointer types). It is derived from
+        * RingBufferSPSCBase of the same template argument type which own an implementation instance.
+        *
+        * @tparam T The ring buffer element type (not for pointer types).
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float or a small POD
+        * structure).
+        */
+        template< typename T >
+        class RingBufferSPSC : public RingBufferSPSCBase< T >
+        {
+        private:
+            /**
+            * @brief Alias Type to RingBufferSPSCBase< T >
+            *
+            * This type provides a little "syntactic sugar" for the class.
+            */
+            using Base = RingBufferSPSCBase< T >;
+
+        public:
+            /**
+            * @brief Inherit Constructors from Base Class
+            *
+            * We add no additional attributes. This declaration specifies that we
+            * want the Base version of constructors exposed as our own.
+            */
+            using Base::RingBufferSPSCBase;
+
+            /**
+            * @brief Inherit the Get Operation
+            *
+            * This declaration brings the get operation from our Base class into the public scope.
+            */
+            using Base::get;
+
+            /**
+            * @brief Inherit the Put Operation
+            *
+            * This declaration brings the put operation from our Base class into the public scope.
+            */
+            using Base::put;
+
+            /**
+            * @brief Inherit the Try Get Operation
+            *
+            * This declaration brings the tryGet operation from our Base class into the public scope.
+            */
+            using Base::tryGet;
+
+            /**
+            * @brief Inherit the Try Put Operation
+            *
+            * This declaration brings the tryPut operation from our Base class into the public scope.
+            */
+            using Base::tryPut;
+
+            /**
+            * @brief Inherit the Reserve Operation
+            *
+            * This declaration brings the reserve operation from our Base class into the public scope.
+            */
+            using Base::reserve;
+
+            /**
+            * @brief Inherit the Commit Operation
+            *
+            * This declaration brings the commit operation from our Base class into the public scope.
+            */
+            using Base::commit;
+
+            /**
+            * @brief Inherit the Peek Span Operation
+            *
+            * This declaration brings the peekSpan operation from our Base class into the public scope.
+            */
+            using Base::peekSpan;
+
+            /**
+            * @brief Inherit the Release Operation
+            *
+            * This declaration brings the release operation from our Base class into the public scope.
+            */
+            using Base::release;
+
+            /**
+            * @brief Inherit the Get Number of Bits Operation
+            *
+            * This declaration brings the getNumBits operation from our Base class into the public scope.
+            */
+            using Base::getNumBits;
+
+            /**
+            * @brief Inherit the Get Size Operation
+            *
+            * This declaration brings the getSize operation from our Base class into the public scope.
+            */
+            using Base::getSize;
+
+            /**
+            * @brief Inherit the Get Mask Operation
+            *
+            * This declaration brings the getMask operation from our Base class into the public scope.
+            */
+            using Base::getMask;
+        };
+
+        /**
+        * @brief Specialization of RingBufferSPSC for void Pointer Type
+        *
+        * This specialization of the RingBufferSPSCBase is specifically designed to handle void pointer
+        * type values. It was designed to handle a wide variety of concrete typed pointers
+        * that can transparently be cast back and forth with void pointers, thereby simplifying
+        * the type pointer template. It inherits directly from the RingBufferSPSCBase.
+        */
+        template<>
+        class RingBufferSPSC< void * > : public RingBufferSPSCBase< void * >
+        {
+        private:
+            /**
+            * @brief Alias Type to RingBufferSPSCBase< void * >
+            *
+            * This type provides a little "syntactic sugar" for the class.
+            */
+            using Base = RingBufferSPSCBase< void * >;
+
+        public:
+            /**
+            * @brief Inherit Constructors from Base Class
+            *
+            * We add no additional attributes. This declaration specifies that we
+            * want the Base version of constructors exposed as our own.
+            */
+            using Base::RingBufferSPSCBase;
+
+            /**
+            * @brief Inherit the Get Operation
+            *
+            * This declaration brings the get operation from our Base class into the public scope.
+            */
+            using Base::get;
+
+            /**
+            * @brief Inherit the Put Operation
+            *
+            * This declaration brings the put operation from our Base class into the public scope.
+            */
+            using Base::put;
+
+            /**
+            * @brief Inherit the Try Get Operation
+            *
+            * This declaration brings the tryGet operation from our Base class into the public scope.
+            */
+            using Base::tryGet;
+
+            /**
+            * @brief Inherit the Try Put Operation
+            *
+            * This declaration brings the tryPut operation from our Base class into the public scope.
+            */
+            using Base::tryPut;
+
+            /**
+            * @brief Inherit the Reserve Operation
+            *
+            * This declaration brings the reserve operation from our Base class into the public scope.
+            */
+            using Base::reserve;
+
+            /**
+            * @brief Inherit the Commit Operation
+            *
+            * This declaration brings the commit operation from our Base class into the public scope.
+            */
+            using Base::commit;
+
+            /**
+            * @brief Inherit the Peek Span Operation
+            *
+            * This declaration brings the peekSpan operation from our Base class into the public scope.
+            */
+            using Base::peekSpan;
+
+            /**
+            * @brief Inherit the Release Operation
+            *
+            * This declaration brings the release operation from our Base class into the public scope.
+            */
+            using Base::release;
+
+            /**
+            * @brief Inherit the Get Number of Bits Operation
+            *
+            * This declaration brings the getNumBits operation from our Base class into the public scope.
+            */
+            using Base::getNumBits;
+
+            /**
+            * @brief Inherit the Get Size Operation
+            *
+            * This declaration brings the getSize operation from our Base class into the public scope.
+            */
+            using Base::getSize;
+
+            /**
+            * @brief Inherit the Get Mask Operation
+            *
+            * This declaration brings the getMask operation from our Base class into the public scope.
+            */
+            using Base::getMask;
+        };
+
+        /**
+        * @brief A Partial Specialization for Concrete Type Pointers
+        *
+        * This partial specialization is provided for pointers to any type to be put into or retrieved from
+        * a RingBufferSPSC. It relies on its base class, RingBufferSPSC< void * >, for all but a cast to and fro.
+        */
+        template< typename T >
+        class RingBufferSPSC< T * > : public RingBufferSPSC< void * >
+        {
+        private:
+            /**
+            * @brief Alias Type to RingBufferSPSC< void * >
+            *
+            * This type provides a little "syntactic sugar" for the class.
+            */
+            using Base = RingBufferSPSC< void * >;
+
+            /**
+            * @brief Required Put Type
+            *
+            * Since the RingBufferSPSCImple cannot "put" into a constant buffer location because its internal
+            * representation is not constant. This causes problems when type T is constant. Any constant qualifier
+            * must be removed. Rest assured, the implementation will not mute any such data.
+            */
+            using PutType = typename std::remove_const<T>::type *;
+
+            /**
+            * @brief Hide the Zero-Copy Operations of our Base
+            *
+            * The reserve/commit and peekSpan/release operations of our base would expose void pointer elements.
+            * These declarations make them inaccessible to our clients.
+            */
+            using Base::reserve;
+            using Base::commit;
+            using Base::peekSpan;
+            using Base::release;
+
+        public:
+            /**
+            * @brief Inherit Constructors from Base Class
+            *
+            * We add no additional attributes. This declaration specifies that we
+            * want the Base version of constructors exposed as our own.
+            */
+            using Base::RingBufferSPSC;
+
+            /**
+            * @brief The Get Operation
+            *
+            * This operation invokes the base class to retrieve a void pointer to the specified type
+            * from the base RingBufferSPSC.
+            * The value is compile time converted to a pointer of the specified template type. Thereby,
+            * adding no run-time penalty.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there is no element available to fulfill the request (empty).
+            *
+            * @return Returns a pointer to an object of type T retrieved from the implementation.
+            */
+            inline T * get() { return reinterpret_cast< T* >( Base::get() ); }
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation invokes the base class to put a typed pointer value into the base RingBufferSPSC.
+            * Any constant specification is removed and the typed pointer is implicitly converted to a
+            * void pointer at compile time yielding no run-time penalty.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is no room left to fulfill the request (full).
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            */
+            inline void put( T * p ) { Base::put( const_cast< PutType >( p ) ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation invokes the base class to try retrieving a void pointer to the specified type
+            * from the base RingBufferSPSC. Any value retrieved is converted to a pointer of the specified template type.
+            *
+            * @return Returns an optional holding a pointer to an object of type T. It has no value if the ring buffer was empty.
+            */
+            inline std::optional< T * > tryGet() noexcept
+            {
+                auto val = Base::tryGet();
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation invokes the base class to try putting a typed pointer value into the base RingBufferSPSC.
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            *
+            * @return Returns true if the pointer was put and false if the ring buffer was full.
+            */
+            inline bool tryPut( T * p ) noexcept { return Base::tryPut( const_cast< PutType >( p ) ); }
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERSPSC_HPP */
@@ -0,0 +1,535 @@
+/**
+* @file RingBufferShared.hpp
+* @brief The Specification file for RingBufferShared
+*
+* This file came into existence to allow a producer process and a consumer process (e.g., acquisition and
+* processing, split for fault isolation) to exchange elements through shared memory rather than a socket.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERSHARED_HPP
+#define REISERRT_CORE_RINGBUFFERSHARED_HPP
+
+#include "ReiserRT_CoreExceptions.hpp"
+#include "RingBufferSizing.hpp"
+#include "RingBufferSharedRegion.hpp"
+
+#include <atomic>
+#include <optional>
+#include <new>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief Implementation class for RingBufferShared
+        *
+        * This template class provides a lock-free, single producer, single consumer circular buffer whose control
+        * block and elements reside in a caller provided region of memory that may be shared between processes
+        * (@see RingBufferSharedRegion). The region holds no pointers. The elements are located by an offset from
+        * the control block, so each process may map the region at a different address. The put and get counters
+        * are lock-free atomics, on separate cache lines, published with release semantics and observed with
+        * acquire semantics, as with RingBufferSPSCImple. Instances of this class are process local handles to
+        * the shared ring buffer. One process creates (initializes) the ring buffer and the other attaches to it.
+        *
+        * @warning Only one thread, in any process, may invoke put operations and only one thread, in any process,
+        * may invoke get operations. Violating this requirement results in undefined behavior.
+        *
+        * @tparam ElementType The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line. Pointers are not supported as they
+        * are meaningless in another process.
+        */
+        template< typename ElementType >
+        class RingBufferSharedImple
+        {
+        private:
+            // ElementType must be trivially copyable for rapid load and store operations, default constructible,
+            // non-constant as put requires a write, and no larger than a cache line.
+            static_assert( RingBufferElementTraits< ElementType >::isSupported,
+                    "RingBufferSharedImple<ElementType> must specify a non-const, trivially copyable type no larger than a cache line!" );
+
+            // Pointers are only meaningful within the process that put them.
+            static_assert( !std::is_pointer< ElementType >::value,
+                    "RingBufferSharedImple<ElementType> must not specify a pointer type!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< ElementType >::ParamType;
+
+            /**
+            * @brief Ring Buffer Sizing Type
+            *
+            * This type provides the power of two sizing logic shared by all RingBuffer implementations.
+            */
+            using Sizing = RingBufferSizing<>;
+
+            /**
+            * @brief Ring Buffer 32bit Counter Type
+            *
+            * This counter type is used to track get and put indices.
+            */
+            using CounterType = Sizing::CounterType;
+
+            /**
+            * @brief Atomic Counter Type
+            *
+            * The get and put counters are shared between the producer and consumer processes and must be atomic.
+            */
+            using AtomicCounterType = std::atomic< CounterType >;
+
+            // Our atomic counter type must be lock-free, or it cannot be shared between processes.
+            static_assert( AtomicCounterType::is_always_lock_free,
+                    "RingBufferSharedImple requires a lock-free atomic counter type!" );
+
+            /**
+            * @brief The Shared Control Block
+            *
+            * This structure resides at the start of the shared region. It describes the ring buffer, so that an
+            * attaching process may validate it, and holds the put and get counters on cache lines of their own.
+            * Elements follow at elementsOffset bytes from the start of the control block.
+            */
+            struct ControlBlock
+            {
+                std::atomic< uint32_t > magic;                                  //!< Identifies an initialized control block.
+                uint32_t elementSize;                                           //!< The size of the element type.
+                uint32_t numBits;                                               //!< The number of bits indexing the element buffer.
+                uint32_t elementsOffset;                                        //!< The offset of the element buffer.
+                alignas( ringBufferCacheLineSize ) AtomicCounterType putCount;  //!< The number of elements put.
+                alignas( ringBufferCacheLineSize ) AtomicCounterType getCount;  //!< The number of elements got.
+            };
+
+            /**
+            * @brief The Control Block Magic Number
+            *
+            * This value identifies an initialized control block.
+            */
+            static constexpr uint32_t controlBlockMagic = 0x52425348;
+
+            /**
+            * @brief Friend Declaration
+            *
+            * Template class RingBufferShared is a friend and only it can invoked our member operations.
+            */
+            template< typename ST > friend class RingBufferShared;
+
+        public:
+            /**
+            * @brief Get the Required Bytes Operation
+            *
+            * This operation calculates the size of the region required for a ring buffer of requestedNumElements.
+            *
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the number of bytes is not representable by size_t.
+            *
+            * @return Returns the number of bytes required for the control block and elements.
+            */
+            static constexpr size_t getRequiredBytes( size_t requestedNumElements )
+            {
+                return Sizing::numBytesForNE( Sizing::maskForNB( Sizing::numBitsForNE( requestedNumElements ) ) + 1,
+                                              sizeof( ElementType ), elementsOffset() );
+            }
+
+        protected:
+            /**
+            * @brief Create Constructor for RingBufferSharedImple
+            *
+            * This constructor initializes a control block at the start of a region and returns a handle to it.
+            * The element count is scrutinized in the same manner as RingBufferSimpleImple. The control block is
+            * marked as initialized last, so that an attaching process never sees a partially initialized control block.
+            *
+            * @param pRegion A pointer to the region. It must be aligned to a cache line (as page aligned mappings are).
+            * @param regionBytes The size of the region. It must be at least getRequiredBytes( requestedNumElements ).
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region is misaligned or too small.
+            */
+            RingBufferSharedImple( void * pRegion, size_t regionBytes, size_t requestedNumElements )
+                : pControl{ validateRegion( pRegion, regionBytes, getRequiredBytes( requestedNumElements ) ) }
+            {
+                const CounterType numBits = Sizing::numBitsForNE( requestedNumElements );
+                new ( pControl ) ControlBlock{};
+                pControl->elementSize = uint32_t( sizeof( ElementType ) );
+                pControl->numBits = uint32_t( numBits );
+                pControl->elementsOffset = uint32_t( elementsOffset() );
+                pControl->putCount.store( 0, std::memory_order_relaxed );
+                pControl->getCount.store( 0, std::memory_order_relaxed );
+                attach();
+
+                // Publish the control block as initialized.
+                pControl->magic.store( controlBlockMagic, std::memory_order_release );
+            }
+
+            /**
+            * @brief Attach Constructor for RingBufferSharedImple
+            *
+            * This constructor returns a handle to a control block previously initialized within a region,
+            * by the create constructor, possibly in another process.
+            *
+            * @param pRegion A pointer to the region.
+            * @param regionBytes The size of the region.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region is misaligned, too small, or does not
+            * hold an initialized control block for this element type.
+            */
+            RingBufferSharedImple( void * pRegion, size_t regionBytes )
+                : pControl{ validateRegion( pRegion, regionBytes, sizeof( ControlBlock ) ) }
+            {
+                if ( pControl->magic.load( std::memory_order_acquire ) != controlBlockMagic ||
+                     pControl->elementSize != sizeof( ElementType ) ||
+                     pControl->elementsOffset != elementsOffset() || pControl->numBits > Sizing::numBitsForNE( Sizing::maxElements ) ||
+                     regionBytes < elementsOffset() + ( size_t( sizeof( ElementType ) ) << pControl->numBits ) )
+                {
+                    throw RingBufferStorageError{ "RingBufferSharedImple: Region does not hold a compatible ring buffer!" };
+                }
+                attach();
+            }
+
+            /**
+            * @brief Try to Put an Element Into The RingBufferSharedImple
+            *
+            * This operation attempts to put an element and publish the new putCount.
+            * It may only be invoked by the one producer thread.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the value was put and false if the ring buffer was full.
+            */
+            bool tryPut( ParamType val ) noexcept
+            {
+                const CounterType currentPut = pControl->putCount.load( std::memory_order_relaxed );
+                if ( CounterType( currentPut - cachedGetCount ) == numElements )
+                {
+                    cachedGetCount = pControl->getCount.load( std::memory_order_acquire );
+                    if ( CounterType( currentPut - cachedGetCount ) == numElements ) return false;
+                }
+
+                pElementBuf[ currentPut & numElementsMask ] = val;
+                pControl->putCount.store( currentPut + 1, std::memory_order_release );
+                return true;
+            }
+
+            /**
+            * @brief Try to Get an Element From The RingBufferSharedImple
+            *
+            * This operation attempts to get an element and publish the new getCount.
+            * It may only be invoked by the one consumer thread.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if the ring buffer was empty.
+            */
+            std::optional< ElementType > tryGet() noexcept
+            {
+                const CounterType currentGet = pControl->getCount.load( std::memory_order_relaxed );
+                if ( currentGet == cachedPutCount )
+                {
+                    cachedPutCount = pControl->putCount.load( std::memory_order_acquire );
+                    if ( currentGet == cachedPutCount ) return std::nullopt;
+                }
+
+                ElementType val = pElementBuf[ currentGet & numElementsMask ];
+                pControl->getCount.store( currentGet + 1, std::memory_order_release );
+                return val;
+            }
+
+            /**
+            * @brief Get the Available Count Operation
+            *
+            * @return Returns a snapshot of the number of elements available to get.
+            */
+            [[nodiscard]] size_t getAvailableCount() const noexcept
+            {
+                return CounterType( pControl->putCount.load( std::memory_order_acquire ) -
+                                    pControl->getCount.load( std::memory_order_acquire ) );
+            }
+
+            /**
+            * @brief Get the Number Of Elements Operation
+            *
+            * @return Returns the number of elements that the ring buffer holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return numElements; }
+
+        private:
+            /**
+            * @brief The Elements Offset Operation
+            *
+            * @return Returns the offset from the control block to the element buffer. The control block size is
+            * a multiple of the cache line size due to the alignment of its counters.
+            */
+            static constexpr size_t elementsOffset() noexcept { return sizeof( ControlBlock ); }
+
+            /**
+            * @brief Validate Region Operation
+            *
+            * @param pRegion A pointer to the region.
+            * @param regionBytes The size of the region.
+            * @param requiredBytes The number of bytes required.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region is misaligned or too small.
+            *
+            * @return Returns a pointer to the control block at the start of the region.
+            */
+            static ControlBlock * validateRegion( void * pRegion, size_t regionBytes, size_t requiredBytes )
+            {
+                if ( !pRegion || 0 != reinterpret_cast< uintptr_t >( pRegion ) % alignof( ControlBlock ) )
+                {
+                    throw RingBufferStorageError{ "RingBufferSharedImple: Region is not aligned to a cache line!" };
+                }
+                if ( regionBytes < requiredBytes )
+                {
+                    throw RingBufferStorageError{ "RingBufferSharedImple: Region is too small!" };
+                }
+                return static_cast< ControlBlock * >( pRegion );
+            }
+
+            /**
+            * @brief Attach Operation
+            *
+            * This operation derives our process local attributes from the control block.
+            */
+            void attach() noexcept
+            {
+                numElementsMask = Sizing::maskForNB( pControl->numBits );
+                numElements = numElementsMask + 1;
+                pElementBuf = reinterpret_cast< ElementType * >( reinterpret_cast< char * >( pControl ) + pControl->elementsOffset );
+                // Acquire, as our caches may be relied upon without reloading. The elements they account for must
+                // be visible to us.
+                cachedGetCount = pControl->getCount.load( std::memory_order_acquire );
+                cachedPutCount = pControl->putCount.load( std::memory_order_acquire );
+            }
+
+            /**
+            * @brief The Control Block
+            *
+            * A pointer to the control block, as mapped into this process.
+            */
+            ControlBlock * const pControl;
+
+            /**
+            * @brief The Element Buffer
+            *
+            * A pointer to the element buffer, as mapped into this process.
+            */
+            ElementType * pElementBuf{ nullptr };
+
+            /**
+            * @brief The Number of Elements Mask
+            *
+            * A process local copy of the mask to determine an index into an N element buffer.
+            */
+            CounterType numElementsMask{ 0 };
+
+            /**
+            * @brief The Number of Elements.
+            *
+            * A process local copy of the number of elements.
+            */
+            CounterType numElements{ 0 };
+
+            /**
+            * @brief The Cached Get Count
+            *
+            * The producer's cached copy of the getCount. It is only refreshed when the producer appears to be full.
+            */
+            alignas( ringBufferCacheLineSize ) CounterType cachedGetCount{ 0 };
+
+            /**
+            * @brief The Cached Put Count
+            *
+            * The consumer's cached copy of the putCount. It is only refreshed when the consumer appears to be empty.
+            */
+            alignas( ringBufferCacheLineSize ) CounterType cachedPutCount{ 0 };
+        };
+
+        /**
+        * @brief RingBufferShared Class
+        *
+        * This template class provides a lock-free, single producer, single consumer ring buffer residing in memory
+        * shared between processes. One process creates the ring buffer within a region (e.g., a RingBufferSharedRegion
+        * created by name) and another attaches to it (e.g., a RingBufferSharedRegion attached by the same name).
+        * Either process may be the producer. Neither put nor get operations block or enter the kernel.
+        *
+        * @warning Only one thread, in any process, may invoke put operations and only one thread, in any process,
+        * may invoke get operations. Violating this requirement results in undefined behavior.
+        *
+        * @tparam T The ring buffer element type.
+        * @note Must be a trivially copyable, non-pointer type no larger than a cache line.
+        */
+        template< typename T >
+        class RingBufferShared
+        {
+        private:
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
+
+        public:
+            /**
+            * @brief Get the Required Bytes Operation
+            *
+            * @param requestedNumElements The number of elements requested.
+            *
+            * @return Returns the number of bytes required of a region for a ring buffer of requestedNumElements.
+            */
+            static constexpr size_t getRequiredBytes( size_t requestedNumElements )
+            {
+                return RingBufferSharedImple< T >::getRequiredBytes( requestedNumElements );
+            }
+
+            /**
+            * @brief Create Constructor for RingBufferShared
+            *
+            * This constructor creates an empty ring buffer within a region.
+            *
+            * @param region The region. It must be at least getRequiredBytes( requestedNumElements ) in size.
+            * @param requestedNumElements The requested number of elements. The actual size will be the next power of two.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region is too small.
+            */
+            RingBufferShared( RingBufferSharedRegion & region, size_t requestedNumElements )
+                : imple{ region.getData(), region.getNumBytes(), requestedNumElements }
+            {
+            }
+
+            /**
+            * @brief Attach Constructor for RingBufferShared
+            *
+            * This constructor attaches to a ring buffer previously created within a region, possibly by another process.
+            *
+            * @param region The region.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region does not hold a compatible ring buffer.
+            */
+            explicit RingBufferShared( RingBufferSharedRegion & region )
+                : imple{ region.getData(), region.getNumBytes() }
+            {
+            }
+
+            /**
+            * @brief Copy Constructor for RingBufferShared
+            *
+            * Copying RingBufferShared is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferShared of the same templated type.
+            */
+            RingBufferShared( const RingBufferShared & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferShared
+            *
+            * Copy assignment of RingBufferShared is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferShared of the same templated type.
+            */
+            RingBufferShared & operator =( const RingBufferShared & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferShared
+            *
+            * Moving RingBufferShared is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferShared of the same templated type.
+            */
+            RingBufferShared( RingBufferShared && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferShared
+            *
+            * Move assignment of RingBufferShared is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferShared of the same templated type.
+            */
+            RingBufferShared & operator =( RingBufferShared && another ) = delete;
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation attempts to put an element of type T without throwing. Producer thread only.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the element was put and false if full.
+            */
+            inline bool tryPut( ParamType val ) noexcept { return imple.tryPut( val ); }
+
+            /**
+            * @brief The Put Operation
+            *
+            * This operation puts an element of type T. Producer thread only.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if full.
+            *
+            * @param val The value to put.
+            */
+            inline void put( ParamType val )
+            {
+                if ( !imple.tryPut( val ) )
+                {
+                    throw RingBufferOverflow{ "RingBufferShared::put() would result in overflow!" };
+                }
+            }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation attempts to get an element of type T without throwing. Consumer thread only.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if empty.
+            */
+            inline std::optional< T > tryGet() noexcept { return imple.tryGet(); }
+
+            /**
+            * @brief The Get Operation
+            *
+            * This operation gets an element of type T. Consumer thread only.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if empty.
+            *
+            * @return Returns an element of type T.
+            */
+            inline T get()
+            {
+                auto val = imple.tryGet();
+                if ( !val )
+                {
+                    throw RingBufferUnderflow{ "RingBufferShared::get() would result in underflow!" };
+                }
+                return *val;
+            }
+
+            /**
+            * @brief The Get Available Count Operation
+            *
+            * @return Returns a snapshot of the number of elements available to get.
+            */
+            [[nodiscard]] inline size_t getAvailableCount() const noexcept { return imple.getAvailableCount(); }
+
+            /**
+            * @brief The Get Size Operation
+            *
+            * @return Returns the number of elements the ring buffer holds when full.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return imple.getSize(); }
+
+        private:
+            /**
+            * @brief Our Implementation Instance
+            *
+            * This attribute is our process local implementation handle.
+            */
+            RingBufferSharedImple< T > imple;
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERSHARED_HPP */
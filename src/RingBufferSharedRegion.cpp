@@ -0,0 +1,245 @@
+/**
+* @file RingBufferSharedRegion.cpp
+* @brief The Implementation for RingBufferSharedRegion
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "RingBufferSharedRegion.hpp"
+
+#include "ReiserRT_CoreExceptions.hpp"
+
+#include <string>
+#include <cerrno>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace ReiserRT::Core;
+
+/**
+* @brief The Implementation of RingBufferSharedRegion
+*
+* This class provides the implementation specifics for the RingBufferSharedRegion class. Every variant obtains
+* a file descriptor (shm_open or memfd_create), sizes it if creating, maps it shared and then closes the
+* descriptor, as the mapping holds its own reference.
+*/
+class RingBufferSharedRegion::Imple
+{
+private:
+    /**
+    * @brief Friend Declaration
+    *
+    * Class RingBufferSharedRegion is a friend and only it can invoke our member operations.
+    */
+    friend class RingBufferSharedRegion;
+
+    /**
+    * @brief Create Constructor for Implementation
+    *
+    * @param name The name of the region, or nullptr for an anonymous region.
+    * @param theNumBytes The number of bytes required.
+    *
+    * @throw Throws ReiserRT::Core::RingBufferStorageError if the name already exists, or if the region
+    * cannot be created or mapped.
+    */
+    Imple( const char * name, size_t theNumBytes )
+        : numBytes{ theNumBytes }
+    {
+#ifdef __linux__
+        int fd;
+        if ( name )
+        {
+            // Exclusive. Truncating an existing region would pull it out from under any process that has it mapped.
+            fd = shm_open( name, O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR );
+            if ( -1 == fd )
+            {
+                throw RingBufferStorageError{ EEXIST == errno ?
+                    "RingBufferSharedRegion::Imple: shm_open create failed! Name exists, possibly stale." :
+                    "RingBufferSharedRegion::Imple: shm_open create failed!" };
+            }
+            unlinkName = name;
+        }
+        else
+        {
+            fd = memfd_create( "ReiserRT_RingBufferShared", MFD_CLOEXEC );
+            if ( -1 == fd ) throw RingBufferStorageError{ "RingBufferSharedRegion::Imple: memfd_create failed!" };
+        }
+
+        if ( 0 != ftruncate( fd, off_t( numBytes ) ) )
+        {
+            close( fd );
+            if ( name ) shm_unlink( name );
+            throw RingBufferStorageError{ "RingBufferSharedRegion::Imple: ftruncate failed!" };
+        }
+        mapAndClose( fd );
+#else
+        (void)name;
+        throw RingBufferStorageError{ "RingBufferSharedRegion::Imple: Not supported on this platform!" };
+#endif
+    }
+
+    /**
+    * @brief Attach Constructor for Implementation
+    *
+    * @param name The name of an existing region.
+    *
+    * @throw Throws ReiserRT::Core::RingBufferStorageError if the region does not exist or cannot be mapped.
+    */
+    explicit Imple( const char * name )
+    {
+#ifdef __linux__
+        const int fd = shm_open( name, O_RDWR, 0 );
+        if ( -1 == fd ) throw RingBufferStorageError{ "RingBufferSharedRegion::Imple: shm_open attach failed!" };
+
+        struct stat st{};
+        if ( 0 != fstat( fd, &st ) )
+        {
+            close( fd );
+            throw RingBufferStorageError{ "RingBufferSharedRegion::Imple: fstat failed!" };
+        }
+        numBytes = size_t( st.st_size );
+        mapAndClose( fd );
+#else
+        (void)name;
+        throw RingBufferStorageError{ "RingBufferSharedRegion::Imple: Not supported on this platform!" };
+#endif
+    }
+
+    /**
+    * @brief Destructor for the Implementation
+    *
+    * The destructor unmaps the region and, if we created a named region, removes the name.
+    */
+    ~Imple()
+    {
+#ifdef __linux__
+        munmap( pData, numBytes );
+        if ( !unlinkName.empty() ) shm_unlink( unlinkName.c_str() );
+#endif
+    }
+
+    /**
+    * @brief Copy Constructor for Implementation
+    *
+    * Copying the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another Another instance of the implementation.
+    */
+    Imple( const Imple & another ) = delete;
+
+    /**
+    * @brief Copy Assignment Operation for Implementation
+    *
+    * Copying the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another Another instance of the implementation.
+    */
+    Imple & operator =( const Imple & another ) = delete;
+
+    /**
+    * @brief Move Constructor for Implementation
+    *
+    * Moving the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another An rvalue reference to another instance of the implementation.
+    */
+    Imple( Imple && another ) = delete;
+
+    /**
+    * @brief Move Assignment Operation for Implementation
+    *
+    * Moving the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another An rvalue reference to another instance of the implementation.
+    */
+    Imple & operator =( Imple && another ) = delete;
+
+#ifdef __linux__
+    /**
+    * @brief Map and Close Operation
+    *
+    * This operation maps numBytes of a file descriptor shared and closes the descriptor.
+    *
+    * @param fd The file descriptor to map.
+    *
+    * @throw Throws ReiserRT::Core::RingBufferStorageError if the mapping fails.
+    */
+    void mapAndClose( int fd )
+    {
+        void * p = mmap( nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+        close( fd );
+        if ( MAP_FAILED == p )
+        {
+            if ( !unlinkName.empty() ) shm_unlink( unlinkName.c_str() );
+            throw RingBufferStorageError{ "RingBufferSharedRegion::Imple: mmap failed!" };
+        }
+        pData = p;
+    }
+#endif
+
+    /**
+    * @brief The Number of Bytes
+    *
+    * The number of bytes mapped.
+    */
+    size_t numBytes{ 0 };
+
+    /**
+    * @brief The Data Pointer
+    *
+    * A pointer to the region as mapped into this process.
+    */
+    void * pData{ nullptr };
+
+    /**
+    * @brief The Unlink Name
+    *
+    * The name of a region we created, to be removed upon destruction. It is empty otherwise.
+    */
+    std::string unlinkName{};
+};
+
+RingBufferSharedRegion::RingBufferSharedRegion( const char * name, size_t numBytes )
+    : pImple{ new Imple{ name, numBytes } }
+{
+}
+
+RingBufferSharedRegion::RingBufferSharedRegion( const char * name )
+    : pImple{ new Imple{ name } }
+{
+}
+
+RingBufferSharedRegion::RingBufferSharedRegion( size_t numBytes )
+    : pImple{ new Imple{ nullptr, numBytes } }
+{
+}
+
+RingBufferSharedRegion::~RingBufferSharedRegion()
+{
+    delete pImple;
+}
+
+void * RingBufferSharedRegion::getData() const noexcept
+{
+    return pImple->pData;
+}
+
+size_t RingBufferSharedRegion::getNumBytes() const noexcept
+{
+    return pImple->numBytes;
+}
+
+bool RingBufferSharedRegion::removeName( const char * name ) noexcept
+{
+#ifdef __linux__
+    return 0 == shm_unlink( name );
+#else
+    (void)name;
+    return false;
+#endif
+}
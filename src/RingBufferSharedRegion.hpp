@@ -0,0 +1,163 @@
+/**
+* @file RingBufferSharedRegion.hpp
+* @brief The Specification file for RingBufferSharedRegion
+*
+* This file came into existence to provide RingBufferShared with memory that may be shared between processes,
+* either by name (shm_open) or by inheritance across fork (an anonymous memfd).
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERSHAREDREGION_HPP
+#define REISERRT_CORE_RINGBUFFERSHAREDREGION_HPP
+
+#include "ReiserRT_CoreExport.h"
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The RingBufferSharedRegion Class
+        *
+        * This class maps a region of memory which may be shared between processes (presently, Linux only).
+        * A named region is created by one process and attached by others with the same name. The creator
+        * removes the name upon destruction, although the memory remains until all processes have unmapped it.
+        * An anonymous region has no name and is shared only with child processes created by fork after construction.
+        * The region is zero filled upon creation.
+        */
+        class ReiserRT_Core_EXPORT RingBufferSharedRegion
+        {
+        private:
+            /**
+            * @brief Forward Declaration of Hidden Implementation.
+            *
+            * The RingBufferSharedRegion class hides its implementation details by employing the "pImple" idiom.
+            */
+            class Imple;
+
+        public:
+            /**
+            * @brief Create Constructor for RingBufferSharedRegion
+            *
+            * This constructor creates and maps a named region of numBytes. The name must not already exist, as
+            * another process may have that region mapped and truncating it would pull the memory out from under it.
+            * A name left behind by a process that terminated without destroying its region is stale and may be
+            * removed with removeName before retrying.
+            *
+            * @param name The name of the region (e.g., "/myRing"), as specified for shm_open.
+            * @param numBytes The number of bytes required.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the name already exists, or if the region
+            * cannot be created or mapped.
+            */
+            RingBufferSharedRegion( const char * name, size_t numBytes );
+
+            /**
+            * @brief Attach Constructor for RingBufferSharedRegion
+            *
+            * This constructor maps an existing named region, in its entirety.
+            *
+            * @param name The name of the region, as given to the create constructor by another process.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region does not exist or cannot be mapped.
+            */
+            explicit RingBufferSharedRegion( const char * name );
+
+            /**
+            * @brief Anonymous Constructor for RingBufferSharedRegion
+            *
+            * This constructor creates and maps an anonymous region of numBytes, which is shared with child processes
+            * subsequently created by fork.
+            *
+            * @param numBytes The number of bytes required.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the region cannot be created or mapped.
+            */
+            explicit RingBufferSharedRegion( size_t numBytes );
+
+            /**
+            * @brief Destructor for RingBufferSharedRegion
+            *
+            * The destructor unmaps the region. If this instance created a named region, the name is removed.
+            */
+            ~RingBufferSharedRegion();
+
+            /**
+            * @brief Copy Constructor for RingBufferSharedRegion
+            *
+            * Copying RingBufferSharedRegion is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferSharedRegion.
+            */
+            RingBufferSharedRegion( const RingBufferSharedRegion & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferSharedRegion
+            *
+            * Copy assignment of RingBufferSharedRegion is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferSharedRegion.
+            */
+            RingBufferSharedRegion & operator =( const RingBufferSharedRegion & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferSharedRegion
+            *
+            * Moving RingBufferSharedRegion is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferSharedRegion.
+            */
+            RingBufferSharedRegion( RingBufferSharedRegion && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferSharedRegion
+            *
+            * Move assignment of RingBufferSharedRegion is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferSharedRegion.
+            */
+            RingBufferSharedRegion & operator =( RingBufferSharedRegion && another ) = delete;
+
+            /**
+            * @brief The Get Data Operation
+            *
+            * @return Returns a pointer to the start of the region, as mapped into this process.
+            */
+            void * getData() const noexcept;
+
+            /**
+            * @brief The Get Number of Bytes Operation
+            *
+            * @return Returns the number of bytes mapped.
+            */
+            size_t getNumBytes() const noexcept;
+
+            /**
+            * @brief The Remove Name Operation
+            *
+            * This operation removes a region name, such as a stale name left behind by a process that terminated
+            * without destroying its region. Processes which already have the region mapped are unaffected.
+            * It is the caller's responsibility to ensure that the name is not in use by a live creator.
+            *
+            * @param name The name of the region to remove.
+            *
+            * @return Returns true if the name was removed and false if it did not exist or could not be removed.
+            */
+            static bool removeName( const char * name ) noexcept;
+
+        private:
+            /**
+            * @brief Pointer Member to Hidden Implementation
+            *
+            * This is our pointer to our hidden implementation.
+            */
+            Imple * pImple{ nullptr };
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERSHAREDREGION_HPP */
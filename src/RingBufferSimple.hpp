@@ -9,110 +9,565 @@
 #define REISERRT_CORE_RINGBUFFERSIMPLE_HPP
 
 #include "ReiserRT_CoreExceptions.hpp"
+#include "RingBufferSizing.hpp"
+#include "RingBufferSpan.hpp"
+#include "RingBufferStorage.hpp"
 
 #include <type_traits>
 #include <cstdint>
 #include <stdexcept>
 #include <cstddef>
+#include <cstring>
+#include <array>
+#include <optional>
+#include <memory>
+#include <iterator>
 
 namespace ReiserRT
 {
     namespace Core
     {
         /**
-        * @brief Base implementation class for all RingBufferSimple specializations
+        * @brief Element Storage for Compile Time Capacity RingBufferSimpleImple Instances
         *
-        * This template class provides a for a simplistic, circular buffer.
-        * As is, it is not thread safe and must be guarded from concurrent access of both
-        * get and put operations (@see RingBufferGuardedBase).
+        * This template class provides the element storage and sizing attributes for a RingBufferSimpleImple
+        * whose capacity N is specified at compile time. N is rounded up to the next power of two at compile time
+        * and the element buffer is held inline. Hence, no heap allocation is required and an instance may reside
+        * in static storage or be embedded within another object. The sizing attributes are compile time constants
+        * which the compiler may fold directly into index arithmetic.
         *
-        * @tparam T The ring buffer element type.
-        * @note Must be a scalar type (e.g., char, int, float or void pointer or typed pointer).
+        * @tparam ElementType The ring buffer element type.
+        * @tparam N The requested number of elements. Zero selects the heap based specialization.
+        * @tparam CounterT The counter type used to track get and put operations.
         */
-        template< typename ScalarType >
-        class RingBufferSimpleImple
+        template< typename ElementType, size_t N, typename CounterT >
+        class RingBufferSimpleStorage
         {
+        protected:
+            /**
+            * @brief Ring Buffer Sizing Type
+            *
+            * This type provides the power of two sizing logic shared by all RingBuffer implementations.
+            */
+            using Sizing = RingBufferSizing< CounterT >;
+
+            /**
+            * @brief Ring Buffer Counter Type
+            *
+            * This counter type is used to track get and put indices for all RingBuffer implementations.
+            */
+            using CounterType = typename Sizing::CounterType;
+
+            // We do not silently clamp a compile time capacity. It must be within our supported range.
+            static_assert( N <= Sizing::maxElements,
+                    "RingBufferSimpleStorage<ElementType, N> must specify an N no greater than RingBufferSizing::maxElements!" );
+
+            /**
+            * @brief The Number of Bits
+            *
+            * The number of bits required for a mask to determine an index into an N element buffer.
+            */
+            static constexpr CounterType numBits = Sizing::numBitsForNE( N );
+
+            /**
+            * @brief The Number of Elements Mask
+            *
+            * The mask to determine an index into an N element buffer.
+            */
+            static constexpr CounterType numElementsMask = Sizing::maskForNB( numBits );
+
+            /**
+            * @brief The Number of Elements.
+            *
+            * The number of elements that are available for put into RingBufferImple from an empty state,
+            * or got from a RingBufferImple from a full state.
+            */
+            static constexpr CounterType numElements = numElementsMask + 1;
+
+            /**
+            * @brief Default Constructor for RingBufferSimpleStorage
+            *
+            * There is nothing to allocate. The element buffer is left uninitialized as with the heap based
+            * specialization.
+            */
+            RingBufferSimpleStorage() = default;
+
+            /**
+            * @brief The Element Buffer Operation
+            *
+            * @return Returns a pointer to the first element of the inline element buffer.
+            */
+            inline ElementType * elementBuf() noexcept { return elementArray.data(); }
+
+            /**
+            * @brief The Element Buffer Operation (Constant Version)
+            *
+            * @return Returns a pointer to the first element of the inline element buffer.
+            */
+            inline const ElementType * elementBuf() const noexcept { return elementArray.data(); }
+
         private:
-            // ScalarType must be a valid scalar type for rapid load and store operations.
-            static_assert( std::is_scalar< ScalarType >::value,
-                    "RingBufferImple<ScalarType> must specify a scalar type (which includes pointer types)!" );
+            /**
+            * @brief The Element Array.
+            *
+            * This is the inline buffer space in where elements put into RingBufferImple are stored until
+            * subsequently retrieved.
+            */
+            std::array< ElementType, numElements > elementArray;
+        };
 
-            // ScalarType must not be constant. This is primarily necessary for put, which requires a write.
-            static_assert( !std::is_const< ScalarType >::value,
-                    "RingBufferImple<ScalarType> must specify a non-const scalar type (which includes pointer types)!" );
+        /**
+        * @brief Element Storage for Run Time Capacity RingBufferSimpleImple Instances
+        *
+        * This specialization provides the element storage and sizing attributes for a RingBufferSimpleImple
+        * whose capacity is specified at construction. The element buffer is obtained from a RingBufferStorage
+        * instance which, by default, allocates from the standard heap.
+        *
+        * @tparam ElementType The ring buffer element type.
+        * @tparam CounterT The counter type used to track get and put operations.
+        */
+        template< typename ElementType, typename CounterT >
+        class RingBufferSimpleStorage< ElementType, 0, CounterT >
+        {
+        protected:
+            /**
+            * @brief Ring Buffer Sizing Type
+            *
+            * This type provides the power of two sizing logic shared by all RingBuffer implementations.
+            */
+            using Sizing = RingBufferSizing< CounterT >;
 
             /**
-            * @brief Ring Buffer 32bit Counter Type
+            * @brief Ring Buffer Counter Type
             *
             * This counter type is used to track get and put indices for all RingBuffer implementations.
             */
-            using CounterType = uint32_t;
+            using CounterType = typename Sizing::CounterType;
+
+            /**
+            * @brief Qualified Constructor for RingBufferSimpleStorage
+            *
+            * This qualified constructor scrutinizes the requestedNumElements argument. If less than two elements are
+            * requested, two will be allocated. If greater than maxElements is requested, maxElements will be allocated.
+            * Everything in between will be rounded up to the next power of two. Once the actual number of elements to
+            * be allocated is determined, a buffer for elements is obtained as specified by the storage options.
+            *
+            * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            * @param options The storage options. The default obtains the element buffer from the standard heap.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if storage cannot be obtained as specified.
+            */
+            explicit RingBufferSimpleStorage( size_t requestedNumElements,
+                                              const RingBufferStorageOptions & options = RingBufferStorageOptions{} )
+                : numBits{ Sizing::numBitsForNE( requestedNumElements ) }
+                , numElementsMask{ Sizing::maskForNB( numBits ) }
+                , numElements{ numElementsMask + 1 }
+                , storage{ Sizing::numBytesForNE( numElements, sizeof( ElementType ) ), alignof( ElementType ), options }
+                , pElementBuf{ static_cast< ElementType * >( storage.getData() ) }
+            {
+                // Begin the lifetime of our elements. For trivial types, this generates no code.
+                std::uninitialized_default_construct_n( pElementBuf, numElements );
+            }
+
+            /**
+            * @brief Destructor for RingBufferSimpleStorage
+            *
+            * There is nothing to do. Elements are trivially destructible and our storage member returns the
+            * element buffer to its source.
+            */
+            ~RingBufferSimpleStorage() = default;
+
+            /**
+            * @brief The Element Buffer Operation
+            *
+            * @return Returns a pointer to the first element of the heap allocated element buffer.
+            */
+            inline ElementType * elementBuf() noexcept { return pElementBuf; }
+
+            /**
+            * @brief The Element Buffer Operation (Constant Version)
+            *
+            * @return Returns a pointer to the first element of the heap allocated element buffer.
+            */
+            inline const ElementType * elementBuf() const noexcept { return pElementBuf; }
+
+            /**
+            * @brief The Number of Bits
+            *
+            * The number of bits required for a mask to determine an index into an N element buffer.
+            */
+            const CounterType numBits;
+
+            /**
+            * @brief The Number of Elements Mask
+            *
+            * The mask to determine an index into an N element buffer.
+            */
+            const CounterType numElementsMask;
+
+            /**
+            * @brief The Number of Elements.
+            *
+            * The number of elements that are available for put into RingBufferImple from an empty state,
+            * or got from a RingBufferImple from a full state.
+            */
+            const CounterType numElements;
+
+        private:
+            /**
+            * @brief The Element Storage.
+            *
+            * This object owns the memory backing our element buffer.
+            */
+            RingBufferStorage storage;
+
+            /**
+            * @brief The Element Buffer.
+            *
+            * This is the buffer space in where elements put into RingBufferImple are stored until subsequently retrieved.
+            */
+            alignas( ElementType * ) ElementType * const pElementBuf;
+        };
+
+        /**
+        * @brief RingBufferSimpleConstIterator Class
+        *
+        * This template class provides a read only, random access iterator over the elements occupying a RingBufferSimple,
+        * oldest to newest. It holds a pointer to the element buffer, the index mask and a counter. Dereferencing
+        * applies the mask to the counter. It does not consume anything. Any put, get or other mutating operation
+        * on the ring buffer invalidates it.
+        *
+        * @tparam ElementType The ring buffer element type.
+        * @tparam CounterT The counter type of the ring buffer.
+        */
+        template< typename ElementType, typename CounterT >
+        class RingBufferSimpleConstIterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;  //!< Standard iterator category.
+            using value_type = ElementType;                             //!< Standard iterator value type.
+            using difference_type = std::ptrdiff_t;                     //!< Standard iterator difference type.
+            using pointer = const ElementType *;                        //!< Standard iterator pointer type.
+            using reference = const ElementType &;                      //!< Standard iterator reference type.
+
+            /**
+            * @brief Default Constructor for RingBufferSimpleConstIterator
+            *
+            * This constructor instantiates a singular iterator, as required of standard iterators.
+            */
+            RingBufferSimpleConstIterator() = default;
+
+            /**
+            * @brief Qualified Constructor for RingBufferSimpleConstIterator
+            *
+            * @param theElementBuf A pointer to the element buffer.
+            * @param theMask The mask to determine an index into the element buffer.
+            * @param theCount The counter of the element referred to.
+            */
+            RingBufferSimpleConstIterator( const ElementType * theElementBuf, CounterT theMask, CounterT theCount ) noexcept
+                : pElementBuf{ theElementBuf }
+                , mask{ theMask }
+                , count{ theCount }
+            {
+            }
+
+            /**
+            * @brief The Dereference Operation
+            *
+            * @return Returns a constant reference to the element referred to.
+            */
+            inline reference operator *() const noexcept { return pElementBuf[ count & mask ]; }
+
+            /**
+            * @brief The Member Access Operation
+            *
+            * @return Returns a constant pointer to the element referred to.
+            */
+            inline pointer operator ->() const noexcept { return &pElementBuf[ count & mask ]; }
+
+            /**
+            * @brief The Pre-Increment Operation
+            *
+            * @return Returns this iterator, advanced to the next newer element.
+            */
+            inline RingBufferSimpleConstIterator & operator ++() noexcept { ++count; return *this; }
+
+            /**
+            * @brief The Post-Increment Operation
+            *
+            * @return Returns a copy of this iterator, prior to advancing it to the next newer element.
+            */
+            inline RingBufferSimpleConstIterator operator ++( int ) noexcept { auto tmp = *this; ++count; return tmp; }
+
+            /**
+            * @brief The Pre-Decrement Operation
+            *
+            * @return Returns this iterator, moved to the next older element.
+            */
+            inline RingBufferSimpleConstIterator & operator --() noexcept { --count; return *this; }
+
+            /**
+            * @brief The Post-Decrement Operation
+            *
+            * @return Returns a copy of this iterator, prior to moving it to the next older element.
+            */
+            inline RingBufferSimpleConstIterator operator --( int ) noexcept { auto tmp = *this; --count; return tmp; }
+
+            /**
+            * @brief The Addition Assignment Operation
+            *
+            * @param n The number of elements to advance by. It may be negative.
+            *
+            * @return Returns this iterator, advanced by n elements.
+            */
+            inline RingBufferSimpleConstIterator & operator +=( difference_type n ) noexcept
+            {
+                count = CounterT( count + CounterT( n ) );
+                return *this;
+            }
+
+            /**
+            * @brief The Subtraction Assignment Operation
+            *
+            * @param n The number of elements to move back by. It may be negative.
+            *
+            * @return Returns this iterator, moved back by n elements.
+            */
+            inline RingBufferSimpleConstIterator & operator -=( difference_type n ) noexcept
+            {
+                count = CounterT( count - CounterT( n ) );
+                return *this;
+            }
+
+            /**
+            * @brief The Addition Operation
+            *
+            * @param n The number of elements to advance by.
+            *
+            * @return Returns a copy of this iterator, advanced by n elements.
+            */
+            inline RingBufferSimpleConstIterator operator +( difference_type n ) const noexcept
+            {
+                auto tmp = *this;
+                return tmp += n;
+            }
+
+            /**
+            * @brief The Subtraction Operation
+            *
+            * @param n The number of elements to move back by.
+            *
+            * @return Returns a copy of this iterator, moved back by n elements.
+            */
+            inline RingBufferSimpleConstIterator operator -( difference_type n ) const noexcept
+            {
+                auto tmp = *this;
+                return tmp -= n;
+            }
+
+            /**
+            * @brief The Difference Operation
+            *
+            * The counters are unsigned and may have wrapped. Their difference, reinterpreted as signed, is exact.
+            *
+            * @param another Another iterator over the same ring buffer.
+            *
+            * @return Returns the number of elements from another to this iterator.
+            */
+            inline difference_type operator -( const RingBufferSimpleConstIterator & another ) const noexcept
+            {
+                return difference_type( typename std::make_signed< CounterT >::type( count - another.count ) );
+            }
+
+            /**
+            * @brief The Subscript Operation
+            *
+            * @param n The position of the element, relative to this iterator.
+            *
+            * @return Returns a constant reference to the element n positions from this iterator.
+            */
+            inline reference operator []( difference_type n ) const noexcept
+            {
+                return pElementBuf[ CounterT( count + CounterT( n ) ) & mask ];
+            }
 
             /**
-            * @brief Maximum Number of Elements
+            * @brief The Equality Operation
             *
-            * This constant provides the maximum number of elements that may be put into a RingBuffer.
+            * @param another Another iterator over the same ring buffer.
             *
-            * @note This allows 1M of elements.  There's no reason it couldn't go higher (2^31 maybe even 2^32)
-            * It would need to be tested at 2^32 as that is the absolute limit of our CounterType.
+            * @return Returns true if both iterators refer to the same element.
             */
-            static constexpr CounterType maxElements = ( 1 << 20 ); // A quantity of 1M elements.
+            inline bool operator ==( const RingBufferSimpleConstIterator & another ) const noexcept
+            {
+                return count == another.count;
+            }
 
             /**
-            * @brief Helper Operation used by numBitsForNE operation
+            * @brief The Inequality Operation
             *
-            * This recursive operation performs the actual work for the numBitsForNE operation.
+            * @param another Another iterator over the same ring buffer.
             *
-            * @param n The adjusted number of elements from that passed to the numBitsForNE operation.
-            * @return The number of Bits required to index over the original N elements passed to the numBitsForNE
-            * operation.
+            * @return Returns true if the iterators refer to different elements.
             */
-            static CounterType _numBitsForNE( CounterType n )
+            inline bool operator !=( const RingBufferSimpleConstIterator & another ) const noexcept
             {
-                return ( (n > 0) ? ( _numBitsForNE( n >> 1) + 1 ) : 0 );
+                return count != another.count;
             }
 
             /**
-            * @brief Calculate a mask required to filter a counter to an index of N bits
+            * @brief The Less Than Operation
             *
-            * This operation calculates a mask for filtering a counter to an index of N bits.
+            * @param another Another iterator over the same ring buffer.
+            *
+            * @return Returns true if this iterator refers to an older element than another.
+            */
+            inline bool operator <( const RingBufferSimpleConstIterator & another ) const noexcept
+            {
+                return ( *this - another ) < 0;
+            }
+
+            /**
+            * @brief The Greater Than Operation
             *
-            * @param n The number of bits used for a counter.
+            * @param another Another iterator over the same ring buffer.
             *
-            * @return Returns the mask which can be utilized to filter a counter to an index of N bits.
+            * @return Returns true if this iterator refers to a newer element than another.
             */
-            static CounterType maskForNB( CounterType n )
+            inline bool operator >( const RingBufferSimpleConstIterator & another ) const noexcept
             {
-                return ( (n > 0) ? ( 1 << n ) - 1 : 0 );
+                return another < *this;
             }
 
             /**
-            * @brief Calculate the number of bits required an index an adjusted N elements
+            * @brief The Less Than or Equal Operation
             *
-            * This operation calculates the number of bits required to index (starting with zero)
-            * N elements (e.g., 4 elements requires 2 bits (0-3).
+            * @param another Another iterator over the same ring buffer.
             *
-            * @note The requested number of elements is clamped between 2 and maxElements inclusive.
+            * @return Returns true if this iterator does not refer to a newer element than another.
+            */
+            inline bool operator <=( const RingBufferSimpleConstIterator & another ) const noexcept
+            {
+                return !( another < *this );
+            }
+
+            /**
+            * @brief The Greater Than or Equal Operation
             *
-            * @param requestedNumElements The number of elements.
+            * @param another Another iterator over the same ring buffer.
             *
-            * @return Returns the number of bits required to index over N elements.
+            * @return Returns true if this iterator does not refer to an older element than another.
             */
-            static CounterType numBitsForNE( size_t requestedNumElements )
+            inline bool operator >=( const RingBufferSimpleConstIterator & another ) const noexcept
             {
-                // Clamp requested number of elements to a minimum of 2 and a maximum of maxElements.
-                auto n = CounterType( requestedNumElements < 2 ? 2 : requestedNumElements > maxElements ? maxElements : requestedNumElements );
+                return !( *this < another );
+            }
 
-                // Initially subtract 1 from non zero values to correctly calculate the number of bits.
-                return _numBitsForNE( --n >> 1 ) + 1;
+            /**
+            * @brief The Commuted Addition Operation
+            *
+            * @param n The number of elements to advance by.
+            * @param it An iterator.
+            *
+            * @return Returns a copy of the iterator, advanced by n elements.
+            */
+            friend inline RingBufferSimpleConstIterator operator +( difference_type n,
+                                                                    const RingBufferSimpleConstIterator & it ) noexcept
+            {
+                return it + n;
             }
 
+        private:
+            /**
+            * @brief The Element Buffer
+            *
+            * A pointer to the element buffer of the ring buffer iterated.
+            */
+            const ElementType * pElementBuf{ nullptr };
+
+            /**
+            * @brief The Mask
+            *
+            * The mask to determine an index into the element buffer.
+            */
+            CounterT mask{ 0 };
+
+            /**
+            * @brief The Count
+            *
+            * The counter of the element referred to.
+            */
+            CounterT count{ 0 };
+        };
+
+        /**
+        * @brief Base implementation class for all RingBufferSimple specializations
+        *
+        * This template class provides a for a simplistic, circular buffer.
+        * As is, it is not thread safe and must be guarded from concurrent access of both
+        * get and put operations (@see RingBufferGuardedBase).
+        *
+        * @tparam T The ring buffer element type.
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float, void pointer,
+        * typed pointer or a small POD structure).
+        * @tparam N The compile time capacity. Zero (the default) specifies that capacity is determined at construction.
+        * @tparam CounterT The counter type used to track get and put operations. The default 32 bit type supports up to
+        * 2^31 elements. A 64 bit type supports capacities beyond that at the cost of a larger footprint.
+        */
+        template< typename ElementType, size_t N = 0, typename CounterT = uint32_t >
+        class RingBufferSimpleImple : private RingBufferSimpleStorage< ElementType, N, CounterT >
+        {
+        private:
+            // ElementType must be trivially copyable for rapid load and store operations, default constructible,
+            // non-constant as put requires a write, and no larger than a cache line.
+            static_assert( RingBufferElementTraits< ElementType >::isSupported,
+                    "RingBufferSimpleImple<ElementType> must specify a non-const, trivially copyable type no larger than a cache line!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< ElementType >::ParamType;
+
+            /**
+            * @brief Alias Type to RingBufferSimpleStorage< ElementType, N, CounterT >
+            *
+            * This type provides a little "syntactic sugar" for the class.
+            */
+            using Storage = RingBufferSimpleStorage< ElementType, N, CounterT >;
+
+            /**
+            * @brief Ring Buffer Counter Type
+            *
+            * This counter type is used to track get and put indices for all RingBuffer implementations.
+            */
+            using typename Storage::CounterType;
+
+            /**
+            * @brief Storage Attributes and Operations
+            *
+            * These declarations bring the sizing attributes and element buffer access of our Storage into scope.
+            * They are compile time constants when N is specified.
+            */
+            using Storage::numBits;
+            using Storage::numElementsMask;
+            using Storage::numElements;
+            using Storage::elementBuf;
+
+            /**
+            * @brief The Constant Iterator Type
+            *
+            * This type iterates over the elements occupying the implementation, oldest to newest.
+            */
+            using ConstIterator = RingBufferSimpleConstIterator< ElementType, CounterType >;
+
             /**
             * @brief Friend Declaration
             *
             * Template class RingBufferSimpleBase is a friend and only it can invoked our member operations.
             */
-            template< typename ST > friend class RingBufferSimpleBase;
+            template< typename ST, size_t, typename > friend class RingBufferSimpleBase;
 
         protected:
             /**
@@ -124,27 +579,34 @@ namespace ReiserRT
             * Once the actual number of elements to be allocated is determined, a buffer for elements is allocated.
             *
             * @param requestedNumElements The number of elements requested. The actual size will be the next power of two.
+            * @param options The storage options (@see RingBufferStorageOptions).
             * @note 2 is the minimum and maxElements is the maximum. The requestedNumElements will be clamped to
             * this range during construction.
+            * @note This constructor is only available when N is zero.
             */
-            explicit RingBufferSimpleImple( size_t requestedNumElements )
-                : getCount{ CounterType( ~0 ) }
+            template< size_t M = N, typename std::enable_if< M == 0, int >::type = 0 >
+            explicit RingBufferSimpleImple( size_t requestedNumElements,
+                                            const RingBufferStorageOptions & options = RingBufferStorageOptions{} )
+                : Storage{ requestedNumElements, options }
+                , getCount{ CounterType( ~0 ) }
                 , putCount{ CounterType( ~0 ) }
-                , numBits{ numBitsForNE( requestedNumElements ) }
-                , numElementsMask{ maskForNB( numBits ) }
-                , numElements{ numElementsMask + 1 }
-                , pElementBuf{ new ScalarType[ numElements ] }
             {
             }
 
             /**
-            * @brief Destructor for RingBufferSimpleImple
+            * @brief Default Constructor for RingBufferSimpleImple
+            *
+            * This constructor instantiates a RingBufferImple whose capacity, N rounded up to the next power of two,
+            * was determined at compile time.
             *
-            * The destructor returns the ring buffer element block to the standard heap.
+            * @note This constructor is only available when N is non-zero.
             */
-            ~RingBufferSimpleImple()
+            template< size_t M = N, typename std::enable_if< M != 0, int >::type = 0 >
+            RingBufferSimpleImple()
+                : Storage{}
+                , getCount{ CounterType( ~0 ) }
+                , putCount{ CounterType( ~0 ) }
             {
-                delete[] pElementBuf;
             }
 
             /**
@@ -155,7 +617,7 @@ namespace ReiserRT
             *
             * @return Returns an element from the RingBufferSimpleImple.
             */
-            ScalarType get()
+            ElementType get()
             {
                 // To get, we cannot be empty.  If the get count is equal to the put count,
                 // we are empty and will throw underflow.
@@ -166,7 +628,7 @@ namespace ReiserRT
 
                 // If here, we were not empty. Incrementing the getCount,
                 // fetch and return the element.
-                return pElementBuf[ ++getCount & numElementsMask ];
+                return elementBuf()[ ++getCount & numElementsMask ];
             }
 
             /**
@@ -175,7 +637,7 @@ namespace ReiserRT
             * This operation attempts to put an element into the RingBufferImple and advance the putState.
             * @throw Throws ReiserRT::Core::RingBufferOverflow if there is no room left to fulfill the request.
             */
-            void put( ScalarType val )
+            void put( ParamType val )
             {
                 // To put, we cannot be full.  If the put total (sum indication of all put counters),
                 // less the current get completion count, is greater than the number of elements mask
@@ -186,83 +648,321 @@ namespace ReiserRT
                 }
 
                 // If here, we were not full. Load the value we are putting while incrementing the putCount.
-                pElementBuf[ ++putCount & numElementsMask ] = val;
+                elementBuf()[ ++putCount & numElementsMask ] = val;
             }
 
             /**
-            * @brief Get the Number Of Bits Operation
+            * @brief Try to Get an Element From The RingBufferSimpleImple
             *
-            * This operation is primarily useful in validation of the implementation. It returns the
-            * number of bits required to hold an index into an N element buffer.
+            * This operation attempts to get an element from the RingBufferImple and advance the getState.
+            * It does not throw when empty. It reports it.
             *
-            * @return The number of bits required for a mask to determine an index into an N element buffer.
+            * @return Returns an optional holding the element retrieved. It has no value if the RingBufferImple was empty.
             */
-            [[nodiscard]] inline size_t getNumBits() const noexcept { return numBits; }
+            std::optional< ElementType > tryGet() noexcept
+            {
+                // If the get count is equal to the put count, we are empty.
+                if ( ( getCount - putCount + numElements ) > numElementsMask ) return std::nullopt;
+
+                // If here, we were not empty. Incrementing the getCount, fetch and return the element.
+                return elementBuf()[ ++getCount & numElementsMask ];
+            }
 
             /**
-            * @brief Get the Size Operation
+            * @brief Try to Put an Element Into The RingBufferSimpleImple
             *
-            * This operation returns the number of elements actually allocated during construction
-            * based on the requested number of elements.
+            * This operation attempts to put an element into the RingBufferImple and advance the putState.
+            * It does not throw when full. It reports it.
             *
-            * @return The number of elements that are available for put into a RingBufferImple from an empty state,
-            * or got from a RingBufferImple from a full state.
+            * @param val The value to put.
+            *
+            * @return Returns true if the value was put and false if the RingBufferImple was full.
             */
-            [[nodiscard]] inline size_t getSize() const noexcept { return numElements; }
+            bool tryPut( ParamType val ) noexcept
+            {
+                // If the difference between put and get counts exceeds the number of elements mask, we are full.
+                if ( ( putCount - getCount ) > numElementsMask ) return false;
+
+                // If here, we were not full. Load the value we are putting while incrementing the putCount.
+                elementBuf()[ ++putCount & numElementsMask ] = val;
+                return true;
+            }
 
             /**
-            * @brief Get the Mask Operation
+            * @brief Put an Element Into The RingBufferSimpleImple, Overwriting the Oldest if Full
             *
-            * This operation is primarily useful in validation of the implementation. It returns the
-            * mask that is used to internally to transparently manage roll-over of the RingBufferImple.
+            * This operation always puts an element into the RingBufferImple and advances the putState. If full,
+            * the oldest element is first evicted by advancing the getState. It never throws.
             *
-            * @return The mask that is used internally to transparently manage roll-over of the RingBufferImple.
+            * @param val The value to put.
+            *
+            * @return Returns an optional holding the element evicted. It has no value if the RingBufferImple was not full.
             */
-            [[nodiscard]] inline size_t getMask() const noexcept { return numElementsMask; }
+            std::optional< ElementType > putOverwrite( ParamType val ) noexcept
+            {
+                // If full, evict the oldest element by incrementing the getCount.
+                std::optional< ElementType > evicted;
+                if ( ( putCount - getCount ) > numElementsMask ) evicted = elementBuf()[ ++getCount & numElementsMask ];
+
+                // There is now room. Load the value we are putting while incrementing the putCount.
+                elementBuf()[ ++putCount & numElementsMask ] = val;
+                return evicted;
+            }
 
-        private:
             /**
-            * @brief Our Get Count
+            * @brief Get Multiple Elements From The RingBufferSimpleImple
             *
-            * This attribute tracks the get counter
+            * This operation attempts to get n elements from the RingBufferSimpleImple and advance the getCount by n.
+            * The elements are copied in at most two contiguous segments, split at the point where the element buffer
+            * wraps around. Either all n elements are retrieved or none are.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available to fulfill
+            * the request.
+            *
+            * @param pDst A pointer to a destination buffer with room for at least n elements.
+            * @param n The number of elements to get.
             */
-            CounterType getCount;
+            void get( ElementType * pDst, size_t n )
+            {
+                // To get n, we must have at least n elements available. Else we will throw underflow.
+                if ( n > CounterType( putCount - getCount ) )
+                {
+                    throw RingBufferUnderflow{ "RingBufferSimpleImple::get(pDst, n) would result in underflow!" };
+                }
+
+                // If here, we have enough elements. Copy out up to the wrap point and then any remainder.
+                const CounterType first = ( getCount + 1 ) & numElementsMask;
+                const size_t firstSeg = ( n < numElements - first ) ? n : numElements - first;
+                std::memcpy( pDst, elementBuf() + first, firstSeg * sizeof( ElementType ) );
+                std::memcpy( pDst + firstSeg, elementBuf(), ( n - firstSeg ) * sizeof( ElementType ) );
+                getCount += CounterType( n );
+            }
 
             /**
-            * @brief Our Put Count
+            * @brief Put Multiple Elements Into The RingBufferSimpleImple
             *
-            * This attribute tracks the put counter
+            * This operation attempts to put n elements into the RingBufferSimpleImple and advance the putCount by n.
+            * The elements are copied in at most two contiguous segments, split at the point where the element buffer
+            * wraps around. Either all n elements are put or none are.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is not room for n elements to fulfill the request.
+            *
+            * @param pSrc A pointer to a source buffer of at least n elements.
+            * @param n The number of elements to put.
             */
-            CounterType putCount;
+            void put( const ElementType * pSrc, size_t n )
+            {
+                // To put n, we must have room for n elements. Else we will throw overflow.
+                if ( n > numElements - CounterType( putCount - getCount ) )
+                {
+                    throw RingBufferOverflow{ "RingBufferSimpleImple::put(pSrc, n) would result in overflow!" };
+                }
+
+                // If here, we have enough room. Copy in up to the wrap point and then any remainder.
+                const CounterType first = ( putCount + 1 ) & numElementsMask;
+                const size_t firstSeg = ( n < numElements - first ) ? n : numElements - first;
+                std::memcpy( elementBuf() + first, pSrc, firstSeg * sizeof( ElementType ) );
+                std::memcpy( elementBuf(), pSrc + firstSeg, ( n - firstSeg ) * sizeof( ElementType ) );
+                putCount += CounterType( n );
+            }
 
             /**
-            * @brief The Number of Bits
+            * @brief Reserve Contiguous Elements for Put In Place
             *
-            * The number of bits required for a mask to determine an index into an N element buffer.
+            * This operation is the first phase of a zero-copy put. It returns a span of up to n contiguous element
+            * slots that may be written in place. The span is limited by the room available and by the point where the
+            * element buffer wraps around. It may therefore be shorter than requested or even empty. Nothing is
+            * published until the commit operation is invoked.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous, writable element slots.
             */
-            const CounterType numBits;
+            RingBufferSpan< ElementType > reserve( size_t n ) noexcept
+            {
+                const CounterType first = ( putCount + 1 ) & numElementsMask;
+                const size_t room = numElements - CounterType( putCount - getCount );
+                const size_t contiguous = numElements - first;
+                if ( n > room ) n = room;
+                if ( n > contiguous ) n = contiguous;
+                return { elementBuf() + first, n };
+            }
 
             /**
-            * @brief The Number of Elements Mask
+            * @brief Commit Elements Previously Reserved
+            *
+            * This operation is the second phase of a zero-copy put. It advances the putCount by n, publishing
+            * the first n elements of the span previously returned by the reserve operation.
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is not room for n elements.
+            *
+            * @param n The number of elements to publish. This should not exceed the size of the reserved span.
+            */
+            void commit( size_t n )
+            {
+                if ( n > numElements - CounterType( putCount - getCount ) )
+                {
+                    throw RingBufferOverflow{ "RingBufferSimpleImple::commit(n) would result in overflow!" };
+                }
+                putCount += CounterType( n );
+            }
+
+            /**
+            * @brief Peek at Contiguous Elements for Get In Place
+            *
+            * This operation is the first phase of a zero-copy get. It returns a span of up to n contiguous elements
+            * that may be read (or modified) in place. The span is limited by the elements available and by the point
+            * where the element buffer wraps around. It may therefore be shorter than requested or even empty.
+            * Nothing is consumed until the release operation is invoked.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous elements.
+            */
+            RingBufferSpan< ElementType > peekSpan( size_t n ) noexcept
+            {
+                const CounterType first = ( getCount + 1 ) & numElementsMask;
+                const size_t available = CounterType( putCount - getCount );
+                const size_t contiguous = numElements - first;
+                if ( n > available ) n = available;
+                if ( n > contiguous ) n = contiguous;
+                return { elementBuf() + first, n };
+            }
+
+            /**
+            * @brief Release Elements Previously Peeked
+            *
+            * This operation is the second phase of a zero-copy get. It advances the getCount by n, consuming
+            * the first n elements of the span previously returned by the peekSpan operation.
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available.
+            *
+            * @param n The number of elements to consume. This should not exceed the size of the peeked span.
+            */
+            void release( size_t n )
+            {
+                if ( n > CounterType( putCount - getCount ) )
+                {
+                    throw RingBufferUnderflow{ "RingBufferSimpleImple::release(n) would result in underflow!" };
+                }
+                getCount += CounterType( n );
+            }
+
+            /**
+            * @brief Peek at an Element Without Getting It
+            *
+            * This operation copies the i'th oldest element occupying the RingBufferSimpleImple without advancing
+            * the getCount. Zero is the element the next get would return.
+            *
+            * @param i The position of the element, relative to the oldest.
+            *
+            * @return Returns an optional holding a copy of the element. It has no value if fewer than i + 1
+            * elements are available.
+            */
+            std::optional< ElementType > peek( size_t i ) const noexcept
+            {
+                if ( i >= CounterType( putCount - getCount ) ) return std::nullopt;
+                return elementBuf()[ CounterType( getCount + 1 + i ) & numElementsMask ];
+            }
+
+            /**
+            * @brief Get the Put Slot Without Checking
+            *
+            * This operation returns the element slot that the next put fills, without checking for room and without
+            * advancing the putCount. It never reads the getCount. It serves a caller which knows by other means that
+            * the slot is free (@see RingBufferGuardedBase).
+            *
+            * @return Returns a reference to the element slot that the next put fills.
+            */
+            ElementType & putSlot() noexcept { return elementBuf()[ CounterType( putCount + 1 ) & numElementsMask ]; }
+
+            /**
+            * @brief Advance the Put Count Without Checking
+            *
+            * This operation publishes the element slot returned by the putSlot operation by advancing the putCount.
+            * It never reads the getCount.
+            */
+            void advancePut() noexcept { ++putCount; }
+
+            /**
+            * @brief Get an Element Without Checking
+            *
+            * This operation gets an element and advances the getCount without checking for underflow. It never reads
+            * the putCount. It serves a caller which knows by other means that an element is available
+            * (@see RingBufferGuardedBase).
+            *
+            * @return Returns an element from the RingBufferSimpleImple.
+            */
+            ElementType getUnchecked() noexcept { return elementBuf()[ ++getCount & numElementsMask ]; }
+
+            /**
+            * @brief Get the Available Count Operation
+            *
+            * @return Returns the number of elements available to get.
+            */
+            [[nodiscard]] inline size_t getAvailableCount() const noexcept { return CounterType( putCount - getCount ); }
+
+            /**
+            * @brief The Begin Operation
+            *
+            * @return Returns a constant iterator referring to the oldest element.
+            */
+            [[nodiscard]] ConstIterator begin() const noexcept
+            {
+                return ConstIterator{ elementBuf(), numElementsMask, CounterType( getCount + 1 ) };
+            }
+
+            /**
+            * @brief The End Operation
+            *
+            * @return Returns a constant iterator referring past the newest element.
+            */
+            [[nodiscard]] ConstIterator end() const noexcept
+            {
+                return ConstIterator{ elementBuf(), numElementsMask, CounterType( putCount + 1 ) };
+            }
+
+            /**
+            * @brief Get the Number Of Bits Operation
+            *
+            * This operation is primarily useful in validation of the implementation. It returns the
+            * number of bits required to hold an index into an N element buffer.
+            *
+            * @return The number of bits required for a mask to determine an index into an N element buffer.
+            */
+            [[nodiscard]] inline size_t getNumBits() const noexcept { return numBits; }
+
+            /**
+            * @brief Get the Size Operation
+            *
+            * This operation returns the number of elements actually allocated during construction
+            * based on the requested number of elements.
+            *
+            * @return The number of elements that are available for put into a RingBufferImple from an empty state,
+            * or got from a RingBufferImple from a full state.
+            */
+            [[nodiscard]] inline size_t getSize() const noexcept { return numElements; }
+
+            /**
+            * @brief Get the Mask Operation
+            *
+            * This operation is primarily useful in validation of the implementation. It returns the
+            * mask that is used to internally to transparently manage roll-over of the RingBufferImple.
             *
-            * The mask to determine an index into an N element buffer.
+            * @return The mask that is used internally to transparently manage roll-over of the RingBufferImple.
             */
-            const CounterType numElementsMask;
+            [[nodiscard]] inline size_t getMask() const noexcept { return numElementsMask; }
 
+        private:
             /**
-            * @brief The Number of Elements.
+            * @brief Our Get Count
             *
-            * The number of elements that are available for put into RingBufferImple from an empty state,
-            * or got from a RingBufferImple from a full state.
+            * This attribute tracks the get counter
             */
-            const CounterType numElements;
+            CounterType getCount;
 
             /**
-            * @brief The Element Buffer.
+            * @brief Our Put Count
             *
-            * This is the buffer space in where elements put into RingBufferImple are stored until subsequently retrieved.
+            * This attribute tracks the put counter
             */
-            alignas( ScalarType * ) ScalarType * pElementBuf;
+            CounterType putCount;
         };
 
         /**
@@ -275,28 +975,66 @@ namespace ReiserRT
         * @note All constructors have to be public to be inherited as public with using declaration for derived classes.
         *
         * @tparam T The ring buffer element type.
-        * @note Must be a scalar type (e.g., char, int, float or void pointer or typed pointer).
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float, void pointer,
+        * typed pointer or a small POD structure).
+        * @tparam N The compile time capacity. Zero (the default) specifies that capacity is determined at construction.
+        * @tparam CounterT The counter type used to track get and put operations.
         */
-        template< typename T >
+        template< typename T, size_t N = 0, typename CounterT = uint32_t >
         class RingBufferSimpleBase
         {
         private:
-            // T must be a valid scalar type for rapid load and store operations. Non-scalar types are supportable
-            // through a type pointer. See class ObjectPool within this namespace for such a use case.
-            static_assert( std::is_scalar< T >::value,
-                    "RingBufferSimpleBase< T > must specify a scalar type (which includes pointer types)!" );
+            // T must be trivially copyable and no larger than a cache line for rapid load and store operations.
+            // Larger types are supportable through a type pointer. See class ObjectPool within this namespace for such
+            // a use case.
+            static_assert( RingBufferElementTraits< T >::isSupported,
+                    "RingBufferSimpleBase< T > must specify a trivially copyable type no larger than a cache line!" );
+
+            /**
+            * @brief The Put Parameter Type
+            *
+            * Scalar elements are put by value. Others are put by constant reference.
+            */
+            using ParamType = typename RingBufferElementTraits< T >::ParamType;
 
         public:
+            /**
+            * @brief The Constant Iterator Type
+            *
+            * This type iterates over the elements occupying the ring buffer, oldest to newest, without consuming them.
+            */
+            using ConstIterator = RingBufferSimpleConstIterator< T, CounterT >;
 
             /**
             * @brief Qualified Constructor for RingBufferSimpleBase
             *
             * This is our qualified constructor for RingBufferSimpleBase. It instantiates the implementation,
-            * passing it the requestedNumElements argument.
+            * passing it the requestedNumElements and options arguments.
             *
             * @param requestedNumElements The requested number of elements for RingBufferSimpleBase.
+            * @param options The storage options. The default obtains element storage from the standard heap.
+            * Others may request huge pages, locked memory or NUMA node binding (@see RingBufferStorageOptions).
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if storage cannot be obtained as specified.
+            * @note This constructor is only available when N is zero.
+            */
+            template< size_t M = N, typename std::enable_if< M == 0, int >::type = 0 >
+            explicit RingBufferSimpleBase( size_t requestedNumElements,
+                                           const RingBufferStorageOptions & options = RingBufferStorageOptions{} )
+                : imple{ requestedNumElements, options }
+            {
+            }
+
+            /**
+            * @brief Default Constructor for RingBufferSimpleBase
+            *
+            * This is our default constructor for RingBufferSimpleBase with a compile time capacity.
+            * It instantiates the implementation.
+            *
+            * @note This constructor is only available when N is non-zero.
             */
-            explicit RingBufferSimpleBase( size_t requestedNumElements ) : imple{ requestedNumElements }
+            template< size_t M = N, typename std::enable_if< M != 0, int >::type = 0 >
+            RingBufferSimpleBase() : imple{}
             {
             }
 
@@ -358,7 +1096,156 @@ namespace ReiserRT
             *
             * This operation puts an element of type T into the implementation.
             */
-            inline void put( T val ) { imple.put( val ); }
+            inline void put( ParamType val ) { imple.put( val ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation attempts to get an element of type T from the implementation without throwing.
+            *
+            * @return Returns an optional holding the element retrieved. It has no value if the implementation was empty.
+            */
+            inline std::optional< T > tryGet() noexcept { return imple.tryGet(); }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation attempts to put an element of type T into the implementation without throwing.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns true if the element was put and false if the implementation was full.
+            */
+            inline bool tryPut( ParamType val ) noexcept { return imple.tryPut( val ); }
+
+            /**
+            * @brief The Put Overwrite Operation
+            *
+            * This operation puts an element of type T into the implementation. If full, the oldest element is evicted
+            * to make room. It never throws.
+            *
+            * @param val The value to put.
+            *
+            * @return Returns an optional holding the element evicted. It has no value if the implementation was not full.
+            */
+            inline std::optional< T > putOverwrite( ParamType val ) noexcept { return imple.putOverwrite( val ); }
+
+            /**
+            * @brief The Put Slot Operation
+            *
+            * This operation returns the element slot that the next put fills, without checking for room.
+            *
+            * @return Returns a reference to the element slot that the next put fills.
+            */
+            inline T & putSlot() noexcept { return imple.putSlot(); }
+
+            /**
+            * @brief The Advance Put Operation
+            *
+            * This operation publishes the element slot returned by the putSlot operation, without checking for room.
+            */
+            inline void advancePut() noexcept { imple.advancePut(); }
+
+            /**
+            * @brief The Get Unchecked Operation
+            *
+            * This operation gets an element of type T from the implementation without checking for underflow.
+            *
+            * @return Returns type T, returned from the implementation.
+            */
+            inline T getUnchecked() noexcept { return imple.getUnchecked(); }
+
+            /**
+            * @brief The Bulk Get Operation
+            *
+            * This operation gets n elements of type T from the implementation.
+            *
+            * @param pDst A pointer to a destination buffer with room for at least n elements.
+            * @param n The number of elements to get.
+            */
+            inline void get( T * pDst, size_t n ) { imple.get( pDst, n ); }
+
+            /**
+            * @brief The Bulk Put Operation
+            *
+            * This operation puts n elements of type T into the implementation.
+            *
+            * @param pSrc A pointer to a source buffer of at least n elements.
+            * @param n The number of elements to put.
+            */
+            inline void put( const T * pSrc, size_t n ) { imple.put( pSrc, n ); }
+
+            /**
+            * @brief The Reserve Operation
+            *
+            * This operation reserves up to n contiguous element slots of the implementation to be written in place.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous, writable element slots.
+            */
+            inline RingBufferSpan< T > reserve( size_t n ) noexcept { return imple.reserve( n ); }
+
+            /**
+            * @brief The Commit Operation
+            *
+            * This operation publishes n previously reserved elements of the implementation.
+            *
+            * @param n The number of elements to publish.
+            */
+            inline void commit( size_t n ) { imple.commit( n ); }
+
+            /**
+            * @brief The Peek Span Operation
+            *
+            * This operation returns up to n contiguous elements of the implementation to be read in place.
+            *
+            * @param n The number of elements desired.
+            *
+            * @return Returns a span of up to n contiguous elements.
+            */
+            inline RingBufferSpan< T > peekSpan( size_t n ) noexcept { return imple.peekSpan( n ); }
+
+            /**
+            * @brief The Release Operation
+            *
+            * This operation consumes n previously peeked elements of the implementation.
+            *
+            * @param n The number of elements to consume.
+            */
+            inline void release( size_t n ) { imple.release( n ); }
+
+            /**
+            * @brief The Peek Operation
+            *
+            * This operation copies the i'th oldest element of the implementation without consuming it.
+            *
+            * @param i The position of the element, relative to the oldest. The default peeks at the oldest.
+            *
+            * @return Returns an optional holding a copy of the element. It has no value if there is no such element.
+            */
+            inline std::optional< T > peek( size_t i = 0 ) const noexcept { return imple.peek( i ); }
+
+            /**
+            * @brief The Get Available Count Operation
+            *
+            * @return Returns the number of elements available to get from the implementation.
+            */
+            [[nodiscard]] inline size_t getAvailableCount() const noexcept { return imple.getAvailableCount(); }
+
+            /**
+            * @brief The Begin Operation
+            *
+            * @return Returns a constant iterator referring to the oldest element of the implementation.
+            */
+            [[nodiscard]] inline ConstIterator begin() const noexcept { return imple.begin(); }
+
+            /**
+            * @brief The End Operation
+            *
+            * @return Returns a constant iterator referring past the newest element of the implementation.
+            */
+            [[nodiscard]] inline ConstIterator end() const noexcept { return imple.end(); }
 
             /**
             * @brief The Get Number of Bits Operation
@@ -398,28 +1285,34 @@ namespace ReiserRT
             * This is our implementation object. It is simply aggregated. There is no need for another level of
             * indirection. The implementation already has one level.
             */
-            RingBufferSimpleImple< T > imple;
+            RingBufferSimpleImple< T, N, CounterT > imple;
         };
 
         /**
         * @brief RingBufferSimple Class
         *
-        * This template class provides a template for simple scalar types (not pointer types). It is derived from
+        * This template class provides a template for simple value types (not pointer types). It is derived from
         * RingBufferSimpleBase of the same template argument type which own an implementation instance.
         *
         * @tparam T The ring buffer element type (not for pointer types).
-        * @note Must be a scalar type (e.g., char, int, float).
+        * @note Must be a trivially copyable type no larger than a cache line (e.g., char, int, float or a small POD
+        * structure).
+        * @tparam N The compile time capacity. Zero (the default) specifies that capacity is determined at construction.
+        * Otherwise, N is rounded up to the next power of two and elements are stored inline, requiring no heap.
+        * Such instances are default constructed.
+        * @tparam CounterT The counter type used to track get and put operations. The default 32 bit type supports up to
+        * 2^31 elements. Specify uint64_t for larger capacities.
         */
-        template< typename T >
-        class RingBufferSimple : public RingBufferSimpleBase< T >
+        template< typename T, size_t N = 0, typename CounterT = uint32_t >
+        class RingBufferSimple : public RingBufferSimpleBase< T, N, CounterT >
         {
         private:
             /**
-            * @brief Alias Type to RingBufferSimpleBase< T >
+            * @brief Alias Type to RingBufferSimpleBase< T, N, CounterT >
             *
             * This type provides a little "syntactic sugar" for the class.
             */
-            using Base = RingBufferSimpleBase< T >;
+            using Base = RingBufferSimpleBase< T, N, CounterT >;
 
         public:
             /**
@@ -444,6 +1337,83 @@ namespace ReiserRT
             */
             using Base::put;
 
+            /**
+            * @brief Inherit the Try Get Operation
+            *
+            * This declaration brings the tryGet operation from our Base class into the public scope.
+            */
+            using Base::tryGet;
+
+            /**
+            * @brief Inherit the Try Put Operation
+            *
+            * This declaration brings the tryPut operation from our Base class into the public scope.
+            */
+            using Base::tryPut;
+
+            /**
+            * @brief Inherit the Put Overwrite Operation
+            *
+            * This declaration brings the putOverwrite operation from our Base class into the public scope.
+            */
+            using Base::putOverwrite;
+
+            /**
+            * @brief Inherit the Reserve Operation
+            *
+            * This declaration brings the reserve operation from our Base class into the public scope.
+            */
+            using Base::reserve;
+
+            /**
+            * @brief Inherit the Commit Operation
+            *
+            * This declaration brings the commit operation from our Base class into the public scope.
+            */
+            using Base::commit;
+
+            /**
+            * @brief Inherit the Peek Span Operation
+            *
+            * This declaration brings the peekSpan operation from our Base class into the public scope.
+            */
+            using Base::peekSpan;
+
+            /**
+            * @brief Inherit the Release Operation
+            *
+            * This declaration brings the release operation from our Base class into the public scope.
+            */
+            using Base::release;
+
+            /**
+            * @brief Inherit the Peek Operation
+            *
+            * This declaration brings the peek operation from our Base class into the public scope.
+            */
+            using Base::peek;
+
+            /**
+            * @brief Inherit the Get Available Count Operation
+            *
+            * This declaration brings the getAvailableCount operation from our Base class into the public scope.
+            */
+            using Base::getAvailableCount;
+
+            /**
+            * @brief Inherit the Begin Operation
+            *
+            * This declaration brings the begin operation from our Base class into the public scope.
+            */
+            using Base::begin;
+
+            /**
+            * @brief Inherit the End Operation
+            *
+            * This declaration brings the end operation from our Base class into the public scope.
+            */
+            using Base::end;
+
             /**
             * @brief Inherit the Get Number of Bits Operation
             *
@@ -473,17 +1443,20 @@ namespace ReiserRT
         * type values. It was designed to handle a wide variety of concrete typed pointers
         * that can transparently be cast back and forth with void pointers, thereby simplifying
         * the type pointer template. It inherits directly from the RingBufferSimpleBase.
+        *
+        * @tparam N The compile time capacity. Zero (the default) specifies that capacity is determined at construction.
+        * @tparam CounterT The counter type used to track get and put operations.
         */
-        template<>
-        class RingBufferSimple< void * > : public RingBufferSimpleBase< void * >
+        template< size_t N, typename CounterT >
+        class RingBufferSimple< void *, N, CounterT > : public RingBufferSimpleBase< void *, N, CounterT >
         {
         private:
             /**
-            * @brief Alias Type to RingBufferSimpleBase< void * >
+            * @brief Alias Type to RingBufferSimpleBase< void *, N, CounterT >
             *
             * This type provides a little "syntactic sugar" for the class.
             */
-            using Base = RingBufferSimpleBase< void * >;
+            using Base = RingBufferSimpleBase< void *, N, CounterT >;
 
         public:
             /**
@@ -508,6 +1481,83 @@ namespace ReiserRT
             */
             using Base::put;
 
+            /**
+            * @brief Inherit the Try Get Operation
+            *
+            * This declaration brings the tryGet operation from our Base class into the public scope.
+            */
+            using Base::tryGet;
+
+            /**
+            * @brief Inherit the Try Put Operation
+            *
+            * This declaration brings the tryPut operation from our Base class into the public scope.
+            */
+            using Base::tryPut;
+
+            /**
+            * @brief Inherit the Put Overwrite Operation
+            *
+            * This declaration brings the putOverwrite operation from our Base class into the public scope.
+            */
+            using Base::putOverwrite;
+
+            /**
+            * @brief Inherit the Reserve Operation
+            *
+            * This declaration brings the reserve operation from our Base class into the public scope.
+            */
+            using Base::reserve;
+
+            /**
+            * @brief Inherit the Commit Operation
+            *
+            * This declaration brings the commit operation from our Base class into the public scope.
+            */
+            using Base::commit;
+
+            /**
+            * @brief Inherit the Peek Span Operation
+            *
+            * This declaration brings the peekSpan operation from our Base class into the public scope.
+            */
+            using Base::peekSpan;
+
+            /**
+            * @brief Inherit the Release Operation
+            *
+            * This declaration brings the release operation from our Base class into the public scope.
+            */
+            using Base::release;
+
+            /**
+            * @brief Inherit the Peek Operation
+            *
+            * This declaration brings the peek operation from our Base class into the public scope.
+            */
+            using Base::peek;
+
+            /**
+            * @brief Inherit the Get Available Count Operation
+            *
+            * This declaration brings the getAvailableCount operation from our Base class into the public scope.
+            */
+            using Base::getAvailableCount;
+
+            /**
+            * @brief Inherit the Begin Operation
+            *
+            * This declaration brings the begin operation from our Base class into the public scope.
+            */
+            using Base::begin;
+
+            /**
+            * @brief Inherit the End Operation
+            *
+            * This declaration brings the end operation from our Base class into the public scope.
+            */
+            using Base::end;
+
             /**
             * @brief Inherit the Get Number of Bits Operation
             *
@@ -534,18 +1584,22 @@ namespace ReiserRT
         * @brief A Partial Specialization for Concrete Type Pointers
         *
         * This partial specialization is provided for pointers to any type to be put into or retrieved from
-        * a RingBufferSimple. It relies on its base class, RingBufferSimple< void * >, for all but a cast to and fro.
+        * a RingBufferSimple. It relies on its base class, RingBufferSimple< void *, N, CounterT >, for all but a cast
+        * to and fro.
+        *
+        * @tparam N The compile time capacity. Zero (the default) specifies that capacity is determined at construction.
+        * @tparam CounterT The counter type used to track get and put operations.
         */
-        template< typename T >
-        class RingBufferSimple< T * > : public RingBufferSimple< void * >
+        template< typename T, size_t N, typename CounterT >
+        class RingBufferSimple< T *, N, CounterT > : public RingBufferSimple< void *, N, CounterT >
         {
         private:
             /**
-            * @brief Alias Type to RingBufferSimple< void * >
+            * @brief Alias Type to RingBufferSimple< void *, N, CounterT >
             *
             * This type provides a little "syntactic sugar" for the class.
             */
-            using Base = RingBufferSimple< void * >;
+            using Base = RingBufferSimple< void *, N, CounterT >;
 
             /**
             * @brief Required Put Type
@@ -557,6 +1611,21 @@ namespace ReiserRT
             */
             using PutType = typename std::remove_const<T>::type *;
 
+            /**
+            * @brief Hide the Zero-Copy Operations of our Base
+            *
+            * The reserve/commit and peekSpan/release operations, and the begin/end iteration operations, of our base
+            * would expose void pointer elements. These declarations make them inaccessible to our clients.
+            * The peek operation provides typed, non-consuming access instead.
+            */
+            using Base::reserve;
+            using Base::commit;
+            using Base::peekSpan;
+            using Base::release;
+            using Base::begin;
+            using Base::end;
+            using typename Base::ConstIterator;
+
         public:
             /**
             * @brief Inherit Constructors from Base Class
@@ -592,6 +1661,97 @@ namespace ReiserRT
             * @param p A pointer to the object to be put into the ring buffer implementation.
             */
             inline void put( T * p ) { Base::put( const_cast< PutType >( p ) ); }
+
+            /**
+            * @brief The Try Get Operation
+            *
+            * This operation invokes the base class to try retrieving a void pointer to the specified type
+            * from the base RingBufferSimple. Any value retrieved is converted to a pointer of the specified template type.
+            *
+            * @return Returns an optional holding a pointer to an object of type T. It has no value if the ring buffer was empty.
+            */
+            inline std::optional< T * > tryGet() noexcept
+            {
+                auto val = Base::tryGet();
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
+
+            /**
+            * @brief The Try Put Operation
+            *
+            * This operation invokes the base class to try putting a typed pointer value into the base RingBufferSimple.
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            *
+            * @return Returns true if the pointer was put and false if the ring buffer was full.
+            */
+            inline bool tryPut( T * p ) noexcept { return Base::tryPut( const_cast< PutType >( p ) ); }
+
+            /**
+            * @brief The Put Overwrite Operation
+            *
+            * This operation invokes the base class to put a typed pointer value into the base RingBufferSimple,
+            * evicting the oldest pointer if full. Any pointer evicted is converted to a pointer of the specified
+            * template type. The caller is responsible for the evicted object (e.g., returning it to its pool).
+            *
+            * @param p A pointer to the object to be put into the ring buffer implementation.
+            *
+            * @return Returns an optional holding the pointer evicted. It has no value if the ring buffer was not full.
+            */
+            inline std::optional< T * > putOverwrite( T * p ) noexcept
+            {
+                auto val = Base::putOverwrite( const_cast< PutType >( p ) );
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
+
+            /**
+            * @brief The Peek Operation
+            *
+            * This operation invokes the base class to copy the i'th oldest void pointer without consuming it.
+            * Any value copied is converted to a pointer of the specified template type.
+            *
+            * @param i The position of the element, relative to the oldest. The default peeks at the oldest.
+            *
+            * @return Returns an optional holding a pointer to an object of type T. It has no value if there is no such element.
+            */
+            inline std::optional< T * > peek( size_t i = 0 ) const noexcept
+            {
+                auto val = Base::peek( i );
+                return val ? std::optional< T * >{ reinterpret_cast< T* >( *val ) } : std::nullopt;
+            }
+
+            /**
+            * @brief The Bulk Get Operation
+            *
+            * This operation invokes the base class to retrieve n void pointers into a destination buffer
+            * of pointers to the specified type.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferUnderflow if there are less than n elements available to fulfill
+            * the request.
+            *
+            * @param pDst A pointer to a destination buffer with room for at least n pointers.
+            * @param n The number of pointers to get.
+            */
+            inline void get( T ** pDst, size_t n )
+            {
+                Base::get( reinterpret_cast< void ** >( const_cast< PutType * >( pDst ) ), n );
+            }
+
+            /**
+            * @brief The Bulk Put Operation
+            *
+            * This operation invokes the base class to put n typed pointer values from a source buffer into the
+            * base RingBufferSimple. Any constant specification is removed as with the put operation.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferOverflow if there is not room for n elements to fulfill the request.
+            *
+            * @param pSrc A pointer to a source buffer of at least n pointers.
+            * @param n The number of pointers to put.
+            */
+            inline void put( T * const * pSrc, size_t n )
+            {
+                Base::put( reinterpret_cast< void * const * >( const_cast< PutType const * >( pSrc ) ), n );
+            }
         };
 
     }
@@ -0,0 +1,184 @@
+/**
+* @file RingBufferSizing.hpp
+* @brief The Specification file for RingBufferSizing
+*
+* This file came into existence to share the power of two sizing logic, originally private to
+* RingBufferSimpleImple, with the other ring buffer implementations.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERSIZING_HPP
+#define REISERRT_CORE_RINGBUFFERSIZING_HPP
+
+#include "ReiserRT_CoreExceptions.hpp"
+
+#include <limits>
+#include <type_traits>
+#include <cstdint>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief Ring Buffer Cache Line Size
+        *
+        * This constant specifies the alignment used to keep attributes written by different threads on separate
+        * cache lines, thereby avoiding "false sharing". It is 64 bytes for the platforms we presently support.
+        * We do not use std::hardware_destructive_interference_size as its value may vary between compiler
+        * options and it would be unwise to have it affect the layout of types exposed by our interface.
+        */
+        constexpr size_t ringBufferCacheLineSize = 64;
+
+        /**
+        * @brief The RingBufferElementTraits Class
+        *
+        * This template class specifies the requirements of a ring buffer element type and how elements are
+        * passed to put operations. Elements are copied into and out of ring buffers with plain loads and stores
+        * (or memcpy for bulk operations). Therefore, they must be trivially copyable. They must also be default
+        * constructible as element buffers are default initialized. They are limited to a cache line in size,
+        * beyond which a pointer to a pool allocated object (@see ObjectPool) is the better choice.
+        *
+        * @tparam T The ring buffer element type.
+        */
+        template< typename T >
+        class RingBufferElementTraits
+        {
+        public:
+            /**
+            * @brief Is Supported Indicator
+            *
+            * This constant is true if type T meets the requirements of a ring buffer element type.
+            * Scalar types (e.g., char, int, float or void pointer or typed pointer) always do.
+            */
+            static constexpr bool isSupported = std::is_trivially_copyable< T >::value &&
+                    std::is_default_constructible< T >::value && !std::is_const< T >::value &&
+                    sizeof( T ) <= ringBufferCacheLineSize;
+
+            /**
+            * @brief The Parameter Type
+            *
+            * Scalar types are passed by value. Others types are passed by constant reference.
+            */
+            using ParamType = typename std::conditional< std::is_scalar< T >::value, T, const T & >::type;
+        };
+
+        /**
+        * @brief The RingBufferSizing Class
+        *
+        * This template class provides the sizing logic common to all ring buffer implementations.
+        * A requested number of elements is rounded up to the next power of two, so that a free running counter
+        * may be filtered to an index with a simple mask, transparently managing roll-over.
+        *
+        * @tparam CounterT The counter type used to track get and put operations by a ring buffer implementation.
+        */
+        template< typename CounterT = uint32_t >
+        class RingBufferSizing
+        {
+        public:
+            /**
+            * @brief Ring Buffer Counter Type
+            *
+            * This counter type is used to track get and put indices for a RingBuffer implementation.
+            */
+            using CounterType = CounterT;
+
+            // Counters roll over and the empty/full arithmetic relies on modulo behavior. Hence, unsigned types only.
+            static_assert( std::is_unsigned< CounterType >::value,
+                    "RingBufferSizing<CounterT> must specify an unsigned counter type!" );
+
+            /**
+            * @brief Maximum Number of Elements
+            *
+            * This constant provides the maximum number of elements that may be put into a RingBuffer.
+            * It is the largest power of two representable by our CounterType, so that the number of elements
+            * itself remains representable and the difference between put and get counters never becomes ambiguous.
+            *
+            * @note This is 2^31 for the default 32 bit CounterType and 2^63 for a 64 bit CounterType. Practically
+            * speaking, memory will be exhausted long before the latter is reached.
+            */
+            static constexpr CounterType maxElements =
+                    CounterType( 1 ) << ( std::numeric_limits< CounterType >::digits - 1 );
+
+            /**
+            * @brief Calculate a mask required to filter a counter to an index of N bits
+            *
+            * This operation calculates a mask for filtering a counter to an index of N bits.
+            *
+            * @param n The number of bits used for a counter.
+            *
+            * @return Returns the mask which can be utilized to filter a counter to an index of N bits.
+            */
+            static constexpr CounterType maskForNB( CounterType n )
+            {
+                return ( (n > 0) ? ( CounterType( 1 ) << n ) - 1 : 0 );
+            }
+
+            /**
+            * @brief Calculate the number of bits required an index an adjusted N elements
+            *
+            * This operation calculates the number of bits required to index (starting with zero)
+            * N elements (e.g., 4 elements requires 2 bits (0-3).
+            *
+            * @note The requested number of elements is clamped between 2 and maxElements inclusive.
+            *
+            * @param requestedNumElements The number of elements.
+            *
+            * @return Returns the number of bits required to index over N elements.
+            */
+            static constexpr CounterType numBitsForNE( size_t requestedNumElements )
+            {
+                // Clamp requested number of elements to a minimum of 2 and a maximum of maxElements.
+                auto n = CounterType( requestedNumElements < 2 ? 2 : requestedNumElements > maxElements ? maxElements : requestedNumElements );
+
+                // Initially subtract 1 from non zero values to correctly calculate the number of bits.
+                return _numBitsForNE( --n >> 1 ) + 1;
+            }
+
+            /**
+            * @brief Calculate the number of bytes required for N elements
+            *
+            * This operation calculates the number of bytes required to store N elements of a given size, plus any
+            * additional bytes required by a header. With a 64 bit CounterType, the number of elements may be as large
+            * as 2^63, so the product is checked for overflow rather than allowed to wrap to a small allocation.
+            *
+            * @param numElements The number of elements, as determined by a prior sizing operation.
+            * @param elementSize The size of an element in bytes.
+            * @param headerBytes The number of additional bytes required. The default is zero.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if the number of bytes is not representable by size_t.
+            *
+            * @return Returns the number of bytes required.
+            */
+            static constexpr size_t numBytesForNE( CounterType numElements, size_t elementSize, size_t headerBytes = 0 )
+            {
+                constexpr size_t maxBytes = std::numeric_limits< size_t >::max();
+                if ( uintmax_t( numElements ) > ( maxBytes - headerBytes ) / elementSize )
+                {
+                    throw RingBufferStorageError{ "RingBufferSizing::numBytesForNE: Number of bytes exceeds size_t!" };
+                }
+                return headerBytes + elementSize * size_t( numElements );
+            }
+
+        private:
+            /**
+            * @brief Helper Operation used by numBitsForNE operation
+            *
+            * This recursive operation performs the actual work for the numBitsForNE operation.
+            *
+            * @param n The adjusted number of elements from that passed to the numBitsForNE operation.
+            * @return The number of Bits required to index over the original N elements passed to the numBitsForNE
+            * operation.
+            */
+            static constexpr CounterType _numBitsForNE( CounterType n )
+            {
+                return ( (n > 0) ? ( _numBitsForNE( n >> 1) + 1 ) : 0 );
+            }
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERSIZING_HPP */
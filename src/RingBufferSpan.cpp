@@ -0,0 +1,11 @@
+/**
+* @file RingBufferSpan.cpp
+* @brief The Specification for RingBufferSpan
+*
+* This file exists to keep the CMake suite of tools happy. Particularly certain ctest features
+*
+* @authors: Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "RingBufferSpan.hpp"
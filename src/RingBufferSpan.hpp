@@ -0,0 +1,113 @@
+/**
+* @file RingBufferSpan.hpp
+* @brief The Specification file for RingBufferSpan
+*
+* This file came into existence to support the zero-copy reserve/commit and peekSpan/release operations of our
+* ring buffers. We are a C++17 library and std::span is not available to us.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERSPAN_HPP
+#define REISERRT_CORE_RINGBUFFERSPAN_HPP
+
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The RingBufferSpan Class
+        *
+        * This template class provides a minimal, non-owning view of a contiguous run of ring buffer elements.
+        * It is returned by the reserve and peekSpan operations of ring buffers so that elements may be written or
+        * read in place. It is only valid until the matching commit or release operation is invoked.
+        *
+        * @tparam T The ring buffer element type.
+        */
+        template< typename T >
+        class RingBufferSpan
+        {
+        public:
+            /**
+            * @brief Default Constructor for RingBufferSpan
+            *
+            * This constructor builds an empty span.
+            */
+            RingBufferSpan() noexcept = default;
+
+            /**
+            * @brief Qualified Constructor for RingBufferSpan
+            *
+            * This constructor builds a span over n elements, starting at pData.
+            *
+            * @param theData A pointer to the first element of the span.
+            * @param theSize The number of elements in the span.
+            */
+            RingBufferSpan( T * theData, size_t theSize ) noexcept : pData{ theData }, numElements{ theSize } {}
+
+            /**
+            * @brief The Data Operation
+            *
+            * @return Returns a pointer to the first element of the span.
+            */
+            [[nodiscard]] inline T * data() const noexcept { return pData; }
+
+            /**
+            * @brief The Size Operation
+            *
+            * @return Returns the number of elements in the span.
+            */
+            [[nodiscard]] inline size_t size() const noexcept { return numElements; }
+
+            /**
+            * @brief The Empty Operation
+            *
+            * @return Returns true if the span has no elements.
+            */
+            [[nodiscard]] inline bool empty() const noexcept { return numElements == 0; }
+
+            /**
+            * @brief The Begin Operation
+            *
+            * @return Returns an iterator (pointer) to the first element of the span.
+            */
+            [[nodiscard]] inline T * begin() const noexcept { return pData; }
+
+            /**
+            * @brief The End Operation
+            *
+            * @return Returns an iterator (pointer) to one past the last element of the span.
+            */
+            [[nodiscard]] inline T * end() const noexcept { return pData + numElements; }
+
+            /**
+            * @brief The Subscript Operator
+            *
+            * @param i The index of the element to access. It is not range checked.
+            *
+            * @return Returns a reference to the element at index i.
+            */
+            inline T & operator[]( size_t i ) const noexcept { return pData[ i ]; }
+
+        private:
+            /**
+            * @brief The Data Pointer
+            *
+            * This attribute points to the first element of the span.
+            */
+            T * pData{ nullptr };
+
+            /**
+            * @brief The Number of Elements
+            *
+            * This attribute is the number of elements in the span.
+            */
+            size_t numElements{ 0 };
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERSPAN_HPP */
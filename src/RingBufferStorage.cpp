@@ -0,0 +1,227 @@
+/**
+* @file RingBufferStorage.cpp
+* @brief The Implementation for RingBufferStorage
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#include "RingBufferStorage.hpp"
+
+#include "ReiserRT_CoreExceptions.hpp"
+
+#include <new>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#endif
+
+using namespace ReiserRT::Core;
+
+/**
+* @brief The Implementation of RingBufferStorage
+*
+* This class provides the implementation specifics for the RingBufferStorage class. Default options are satisfied
+* from the ordinary heap. Otherwise, storage is mapped anonymously and configured per the options in the following
+* order: page mode advice, NUMA binding, pre-faulting and then locking. NUMA binding must precede the first touch
+* of any page for it to take effect.
+*/
+class RingBufferStorage::Imple
+{
+private:
+    /**
+    * @brief Friend Declaration
+    *
+    * Class RingBufferStorage is a friend and only it can invoke our member operations.
+    */
+    friend class RingBufferStorage;
+
+    /**
+    * @brief Qualified Constructor for Implementation
+    *
+    * This operation obtains storage per the options.
+    *
+    * @param theNumBytes The number of bytes required.
+    * @param theAlignment The alignment required.
+    * @param options The options specifying how storage is to be obtained.
+    *
+    * @throw Throws ReiserRT::Core::RingBufferStorageError if storage cannot be obtained or configured as specified.
+    */
+    Imple( size_t theNumBytes, size_t theAlignment, const RingBufferStorageOptions & options )
+        : alignment{ theAlignment }
+        , numBytes{ theNumBytes }
+    {
+        if ( options.isDefault() )
+        {
+            pData = ::operator new( numBytes, std::align_val_t{ alignment } );
+            return;
+        }
+
+#ifdef __linux__
+        const bool hugeTlb = options.pageMode == RingBufferStorageOptions::PageMode::HugeTlb;
+
+        // Round up to a whole number of pages. Explicit huge pages are 2MB on the platforms we support.
+        const size_t pageSize = hugeTlb ? size_t( 2 ) << 20 : size_t( sysconf( _SC_PAGESIZE ) );
+        numBytes = ( ( numBytes + pageSize - 1 ) / pageSize ) * pageSize;
+
+        const int flags = MAP_PRIVATE | MAP_ANONYMOUS | ( hugeTlb ? MAP_HUGETLB : 0 );
+        void * p = mmap( nullptr, numBytes, PROT_READ | PROT_WRITE, flags, -1, 0 );
+        if ( MAP_FAILED == p )
+        {
+            throw RingBufferStorageError{ hugeTlb ?
+                "RingBufferStorage::Imple: mmap with MAP_HUGETLB failed! Are huge pages reserved?" :
+                "RingBufferStorage::Imple: mmap failed!" };
+        }
+        pData = p;
+        isMapped = true;
+
+        // Any failure from here on must return our mapping before throwing, as our destructor will not be invoked.
+        try
+        {
+            if ( options.pageMode == RingBufferStorageOptions::PageMode::TransparentHuge &&
+                 0 != madvise( pData, numBytes, MADV_HUGEPAGE ) )
+            {
+                throw RingBufferStorageError{ "RingBufferStorage::Imple: madvise(MADV_HUGEPAGE) failed!" };
+            }
+
+            if ( options.numaNode >= 0 )
+            {
+                // The node mask is a bit mask of nodes. We support up to as many nodes as bits in an unsigned long.
+                constexpr int maxNumaNodes = int( sizeof( unsigned long ) * 8 );
+                if ( options.numaNode >= maxNumaNodes )
+                {
+                    throw RingBufferStorageError{ "RingBufferStorage::Imple: NUMA node out of range!" };
+                }
+                const unsigned long nodeMask = 1UL << options.numaNode;
+                // The kernel decrements maxnode before reading the mask. Hence, one more than the bits in our mask.
+                if ( 0 != syscall( SYS_mbind, pData, numBytes, MPOL_BIND, &nodeMask, maxNumaNodes + 1, 0 ) )
+                {
+                    throw RingBufferStorageError{ "RingBufferStorage::Imple: mbind failed!" };
+                }
+            }
+
+            if ( options.prefault )
+            {
+                // Touch every page, so that they are faulted in now and not in the realtime path.
+                auto pBytes = static_cast< volatile char * >( pData );
+                for ( size_t i = 0; i < numBytes; i += pageSize ) pBytes[ i ] = 0;
+            }
+
+            if ( options.lockMemory && 0 != mlock( pData, numBytes ) )
+            {
+                throw RingBufferStorageError{ "RingBufferStorage::Imple: mlock failed! Check RLIMIT_MEMLOCK." };
+            }
+        }
+        catch ( ... )
+        {
+            munmap( pData, numBytes );
+            throw;
+        }
+#else
+        throw RingBufferStorageError{ "RingBufferStorage::Imple: Non-default options are not supported on this platform!" };
+#endif
+    }
+
+    /**
+    * @brief Destructor for the Implementation
+    *
+    * The destructor returns storage to its source. Unmapping also unlocks any locked pages.
+    */
+    ~Imple()
+    {
+#ifdef __linux__
+        if ( isMapped )
+        {
+            munmap( pData, numBytes );
+            return;
+        }
+#endif
+        ::operator delete( pData, std::align_val_t{ alignment } );
+    }
+
+    /**
+    * @brief Copy Constructor for Implementation
+    *
+    * Copying the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another Another instance of the implementation.
+    */
+    Imple( const Imple & another ) = delete;
+
+    /**
+    * @brief Copy Assignment Operation for Implementation
+    *
+    * Copying the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another Another instance of the implementation.
+    */
+    Imple & operator =( const Imple & another ) = delete;
+
+    /**
+    * @brief Move Constructor for Implementation
+    *
+    * Moving the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another An rvalue reference to another instance of the implementation.
+    */
+    Imple( Imple && another ) = delete;
+
+    /**
+    * @brief Move Assignment Operation for Implementation
+    *
+    * Moving the implementation is disallowed. Hence, this operation has been deleted.
+    *
+    * @param another An rvalue reference to another instance of the implementation.
+    */
+    Imple & operator =( Imple && another ) = delete;
+
+    /**
+    * @brief The Alignment
+    *
+    * The alignment requested. It is required to return heap storage.
+    */
+    const size_t alignment;
+
+    /**
+    * @brief The Number of Bytes
+    *
+    * The number of bytes obtained. For mapped storage, this is rounded up to a multiple of the page size.
+    */
+    size_t numBytes;
+
+    /**
+    * @brief The Data Pointer
+    *
+    * A pointer to the storage obtained.
+    */
+    void * pData{ nullptr };
+
+    /**
+    * @brief The Is Mapped Flag
+    *
+    * This attribute indicates that the storage was mapped from the operating system rather than the heap.
+    */
+    bool isMapped{ false };
+};
+
+RingBufferStorage::RingBufferStorage( size_t numBytes, size_t alignment, const RingBufferStorageOptions & options )
+    : pImple{ new Imple{ numBytes, alignment, options } }
+{
+}
+
+RingBufferStorage::~RingBufferStorage()
+{
+    delete pImple;
+}
+
+void * RingBufferStorage::getData() const noexcept
+{
+    return pImple->pData;
+}
+
+size_t RingBufferStorage::getNumBytes() const noexcept
+{
+    return pImple->numBytes;
+}
@@ -0,0 +1,166 @@
+/**
+* @file RingBufferStorage.hpp
+* @brief The Specification file for RingBufferStorage
+*
+* This file came into existence to allow the element storage of large ring buffers to be backed by huge pages,
+* locked into memory or bound to a NUMA node. Such rings otherwise suffer TLB misses and first-touch page faults
+* in the realtime path.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_RINGBUFFERSTORAGE_HPP
+#define REISERRT_CORE_RINGBUFFERSTORAGE_HPP
+
+#include "ReiserRT_CoreExport.h"
+
+#include <cstdint>
+#include <cstddef>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The RingBufferStorageOptions Structure
+        *
+        * This structure specifies how the element storage of a ring buffer is to be obtained. The default
+        * specifies ordinary heap storage, as ring buffers have always used. Any other specification results in
+        * storage being mapped directly from the operating system (presently, Linux only).
+        */
+        struct RingBufferStorageOptions
+        {
+            /**
+            * @brief The Page Mode
+            *
+            * This enumeration specifies the page size backing the storage.
+            */
+            enum class PageMode : uint8_t
+            {
+                Default=0,          //!< Ordinary pages.
+                HugeTlb,            //!< Explicit huge pages (MAP_HUGETLB). These must be reserved by the system administrator.
+                TransparentHuge,    //!< Transparent huge pages, advised via madvise(MADV_HUGEPAGE).
+            };
+
+            PageMode pageMode{ PageMode::Default }; //!< The page mode. See PageMode.
+            bool lockMemory{ false };               //!< If true, the storage is locked into memory (mlock) and never paged out.
+            bool prefault{ false };                 //!< If true, every page is touched at construction avoiding first-touch faults later.
+            int numaNode{ -1 };                     //!< If non-negative, the storage is bound to this NUMA node (mbind).
+
+            /**
+            * @brief Is Default Operation
+            *
+            * @return Returns true if these options specify ordinary heap storage.
+            */
+            [[nodiscard]] inline bool isDefault() const noexcept
+            {
+                return pageMode == PageMode::Default && !lockMemory && !prefault && numaNode < 0;
+            }
+        };
+
+        /**
+        * @brief The RingBufferStorage Class
+        *
+        * This class provides raw, aligned element storage for a ring buffer according to RingBufferStorageOptions.
+        * It owns the storage and returns it to its source upon destruction. It does not construct or destroy
+        * elements. Ring buffer elements are trivially copyable and need not be.
+        */
+        class ReiserRT_Core_EXPORT RingBufferStorage
+        {
+        private:
+            /**
+            * @brief Forward Declaration of Hidden Implementation.
+            *
+            * The RingBufferStorage class hides its implementation details by employing the "pImple" idiom.
+            */
+            class Imple;
+
+        public:
+            /**
+            * @brief Qualified Constructor for RingBufferStorage
+            *
+            * This operation obtains storage of at least numBytes, aligned to at least alignment, as specified
+            * by options.
+            *
+            * @param numBytes The number of bytes required.
+            * @param alignment The alignment required. It must be a power of two.
+            * @param options The options specifying how storage is to be obtained.
+            *
+            * @throw Throws ReiserRT::Core::RingBufferStorageError if storage cannot be obtained or configured as specified.
+            * @throw Throws std::bad_alloc if ordinary heap storage cannot be obtained.
+            */
+            RingBufferStorage( size_t numBytes, size_t alignment, const RingBufferStorageOptions & options );
+
+            /**
+            * @brief Destructor for RingBufferStorage
+            *
+            * The destructor returns storage to its source.
+            */
+            ~RingBufferStorage();
+
+            /**
+            * @brief Copy Constructor for RingBufferStorage
+            *
+            * Copying RingBufferStorage is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferStorage.
+            */
+            RingBufferStorage( const RingBufferStorage & another ) = delete;
+
+            /**
+            * @brief Copy Assignment Operation for RingBufferStorage
+            *
+            * Copying RingBufferStorage is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another Another instance of a RingBufferStorage.
+            */
+            RingBufferStorage & operator =( const RingBufferStorage & another ) = delete;
+
+            /**
+            * @brief Move Constructor for RingBufferStorage
+            *
+            * Moving RingBufferStorage is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferStorage.
+            */
+            RingBufferStorage( RingBufferStorage && another ) = delete;
+
+            /**
+            * @brief Move Assignment Operation for RingBufferStorage
+            *
+            * Moving RingBufferStorage is disallowed. Hence, this operation has been deleted.
+            *
+            * @param another An rvalue reference to another instance of a RingBufferStorage.
+            */
+            RingBufferStorage & operator =( RingBufferStorage && another ) = delete;
+
+            /**
+            * @brief The Get Data Operation
+            *
+            * @return Returns a pointer to the storage.
+            */
+            [[nodiscard]] void * getData() const noexcept;
+
+            /**
+            * @brief The Get Number of Bytes Operation
+            *
+            * This operation returns the number of bytes actually obtained, which may have been rounded up
+            * to a multiple of the page size.
+            *
+            * @return Returns the number of bytes of storage obtained.
+            */
+            [[nodiscard]] size_t getNumBytes() const noexcept;
+
+        private:
+            /**
+            * @brief Pointer Member to Hidden Implementation
+            *
+            * This is our pointer to our hidden implementation.
+            */
+            Imple * pImple{ nullptr };
+        };
+    }
+}
+
+#endif /* REISERRT_CORE_RINGBUFFERSTORAGE_HPP */
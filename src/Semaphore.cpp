@@ -14,16 +14,229 @@
 #include "ReiserRT_CoreExceptions.hpp"
 
 #include <limits>
+#include <algorithm>
 #include <cstdint>
-#ifndef REISER_RT_HAS_PTHREADS
+#if defined( REISER_RT_HAS_FUTEX_SEMAPHORE )
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <climits>
+#include <cerrno>
+#include <exception>
+#include <ctime>
+#elif defined( REISER_RT_HAS_PTHREADS )
+#include <ctime>
+#else
 #include <condition_variable>
 #endif
+#include <atomic>
 #include <mutex>
 #include <thread>
 
 
 using namespace ReiserRT::Core;
 
+#if defined( REISER_RT_HAS_FUTEX_SEMAPHORE ) || defined( REISER_RT_HAS_PTHREADS )
+namespace
+{
+    /**
+    * @brief The To Time Spec Operation
+    *
+    * This operation converts a steady clock time point into the absolute CLOCK_MONOTONIC time specification
+    * expected by pthread_cond_timedwait and FUTEX_WAIT_BITSET. A deadline beyond what time_t can represent,
+    * as a saturated deadline may be, is clamped to the latest time specification, which is treated as forever.
+    *
+    * @param deadline The steady clock time point to convert.
+    *
+    * @return Returns the equivalent time specification.
+    */
+    timespec toTimeSpec( const std::chrono::steady_clock::time_point & deadline )
+    {
+        // Split off whole seconds first. Converting the entire deadline to nanoseconds may overflow.
+        const auto sinceEpoch = std::chrono::duration_cast< std::chrono::seconds >( deadline.time_since_epoch() );
+        timespec deadlineSpec{};
+        if ( sinceEpoch.count() >= std::numeric_limits< time_t >::max() )
+        {
+            deadlineSpec.tv_sec = std::numeric_limits< time_t >::max();
+            deadlineSpec.tv_nsec = 999999999;
+            return deadlineSpec;
+        }
+        const auto remainder = std::chrono::duration_cast< std::chrono::nanoseconds >(
+            deadline.time_since_epoch() - sinceEpoch );
+        deadlineSpec.tv_sec = static_cast< time_t >( sinceEpoch.count() );
+        deadlineSpec.tv_nsec = static_cast< long >( remainder.count() );
+        return deadlineSpec;
+    }
+}
+#endif
+
+#ifdef REISER_RT_HAS_FUTEX_SEMAPHORE
+namespace
+{
+    /**
+    * @brief The Futex Operation
+    *
+    * This operation invokes the futex system call, for which glibc provides no wrapper.
+    */
+    inline long futex( std::atomic< uint32_t > * pWord, int op, uint32_t val, const timespec * pTimeout = nullptr,
+                       uint32_t val3 = 0 ) noexcept
+    {
+        return syscall( SYS_futex, reinterpret_cast< uint32_t * >( pWord ), op, val, pTimeout, nullptr, val3 );
+    }
+
+    /**
+    * @brief A Priority Inheriting Futex Mutex Class
+    *
+    * This class provides a mutex whose uncontended lock and unlock are each a single compare and exchange of
+    * the owner's thread id into, and out of, the futex word. Only under contention does it enter the kernel,
+    * via FUTEX_LOCK_PI and FUTEX_UNLOCK_PI, which provide priority inheritance as our pthread based Mutex does.
+    * It satisfies the Lockable requirements of std::unique_lock and std::lock_guard.
+    */
+    class FutexPiMutex
+    {
+    public:
+        /**
+        * @brief The Lock Operation
+        *
+        * This operation acquires the mutex, blocking in the kernel only if another thread owns it.
+        */
+        void lock() noexcept
+        {
+            uint32_t expected = 0;
+            if ( word.compare_exchange_strong( expected, threadId(), std::memory_order_acquire, std::memory_order_relaxed ) )
+                return;
+
+            // Contended. The kernel sets FUTEX_WAITERS, boosts the owner and returns once we own it.
+            // It may ask us to retry (e.g., the owner is exiting). Any other failure leaves us not owning
+            // the mutex. Carrying on would break mutual exclusion, so we terminate.
+            while ( futex( &word, FUTEX_LOCK_PI_PRIVATE, 0 ) != 0 )
+            {
+                if ( errno != EINTR && errno != EAGAIN ) std::terminate();
+            }
+        }
+
+        /**
+        * @brief The Unlock Operation
+        *
+        * This operation releases the mutex, entering the kernel only if FUTEX_WAITERS has been set.
+        */
+        void unlock() noexcept
+        {
+            uint32_t expected = threadId();
+            if ( word.compare_exchange_strong( expected, 0, std::memory_order_release, std::memory_order_relaxed ) )
+                return;
+
+            // Contended. The kernel hands the mutex to the highest priority waiter. Failure means we did not own it.
+            if ( futex( &word, FUTEX_UNLOCK_PI_PRIVATE, 0 ) != 0 ) std::terminate();
+        }
+
+    private:
+        /**
+        * @brief The Thread Id Operation
+        *
+        * @return Returns the kernel thread id of the invoking thread, cached upon first use.
+        */
+        static uint32_t threadId() noexcept
+        {
+            if ( 0 == cachedThreadId ) cachedThreadId = static_cast< uint32_t >( syscall( SYS_gettid ) );
+            return cachedThreadId;
+        }
+
+        /**
+        * @brief The Static Reset Thread Id Operation
+        *
+        * This operation is registered with pthread_atfork. It runs in the child, upon the only thread to survive
+        * the fork, whose cached thread id is otherwise that of its parent.
+        */
+        static void resetThreadId() noexcept { cachedThreadId = 0; }
+
+        /**
+        * @brief The Cached Thread Id
+        *
+        * This holds the kernel thread id of each thread, or zero until first use.
+        */
+        static thread_local uint32_t cachedThreadId;
+
+        /**
+        * @brief The At Fork Registration
+        *
+        * This holds the result of registering resetThreadId with pthread_atfork, once per process.
+        */
+        static const int atForkRegistration;
+
+        /**
+        * @brief The Futex Word
+        *
+        * This word holds zero when unlocked, else the owner's thread id, or'ed with FUTEX_WAITERS under contention.
+        */
+        std::atomic< uint32_t > word{ 0 };
+    };
+
+    thread_local uint32_t FutexPiMutex::cachedThreadId{ 0 };
+    const int FutexPiMutex::atForkRegistration{ pthread_atfork( nullptr, nullptr, &FutexPiMutex::resetThreadId ) };
+
+    /**
+    * @brief A Futex Condition Variable Class
+    *
+    * This class provides a condition variable upon a sequence word. Notification increments the sequence and
+    * wakes waiters. A waiter samples the sequence before unlocking and sleeps only if it remains unchanged,
+    * so that no notification is lost. Notifiers skip the system call entirely when nobody waits, which our
+    * Semaphore determines by its pending counts.
+    */
+    class FutexConditionVar
+    {
+    public:
+        /**
+        * @brief The Wait Operation
+        *
+        * This operation unlocks the mutex and waits for a notification, or the deadline if one is specified.
+        * The mutex is re-locked upon return. Spurious returns are possible.
+        *
+        * @param lock Our locked mutex.
+        * @param pDeadline A pointer to the absolute CLOCK_MONOTONIC deadline, or nullptr to wait indefinitely.
+        */
+        void wait( std::unique_lock< FutexPiMutex > & lock, const timespec * pDeadline ) noexcept
+        {
+            const auto seq = sequence.load( std::memory_order_relaxed );
+            lock.unlock();
+            futex( &sequence, FUTEX_WAIT_BITSET_PRIVATE, seq, pDeadline, FUTEX_BITSET_MATCH_ANY );
+            lock.lock();
+        }
+
+        /**
+        * @brief The Notify One Operation
+        *
+        * This operation wakes at most one waiter. It expects the mutex to be locked upon invocation.
+        */
+        void notify_one() noexcept
+        {
+            sequence.fetch_add( 1, std::memory_order_relaxed );
+            futex( &sequence, FUTEX_WAKE_PRIVATE, 1 );
+        }
+
+        /**
+        * @brief The Notify All Operation
+        *
+        * This operation wakes all waiters. It expects the mutex to be locked upon invocation.
+        */
+        void notify_all() noexcept
+        {
+            sequence.fetch_add( 1, std::memory_order_relaxed );
+            futex( &sequence, FUTEX_WAKE_PRIVATE, INT_MAX );
+        }
+
+    private:
+        /**
+        * @brief The Sequence Word
+        *
+        * This word is incremented upon every notification.
+        */
+        std::atomic< uint32_t > sequence{ 0 };
+    };
+}
+#endif
+
 /**
 * @brief A Counted, Wait-able Semaphore Class
 *
@@ -31,6 +244,31 @@ using namespace ReiserRT::Core;
 */
 class ReiserRT_Core_EXPORT Semaphore::Imple
 {
+private:
+    /**
+    * @brief Mutex Type
+    *
+    * The type of mutex we are using.
+    */
+#ifdef REISER_RT_HAS_FUTEX_SEMAPHORE
+    using MutexType = FutexPiMutex;
+#else
+    using MutexType = Mutex;
+#endif
+
+    /**
+    * @brief Condition Variable Type
+    *
+    * The type of condition variable we are using.
+    */
+#if defined( REISER_RT_HAS_FUTEX_SEMAPHORE )
+    using ConditionVarType = FutexConditionVar;
+#elif defined( REISER_RT_HAS_PTHREADS )
+    using ConditionVarType = pthread_cond_t;
+#else
+    using ConditionVarType = std::condition_variable_any;
+#endif
+
 public:
     /**
     * @brief Qualified Constructor for Implementation
@@ -42,8 +280,9 @@ public:
     * @param theMaxAvailableCount The maximum Semaphore count. Zero indicates that the Semaphore
     * is essentially unbounded up to a maximum of (2^32-1). If non-zero, it is clamped to be no less than that
     * of the clamped initial count.
+    * @param theWaitPolicy The policy followed by take and give operations that must wait.
     */
-    explicit Imple( size_t theInitialCount, size_t theMaxAvailableCount )
+    explicit Imple( size_t theInitialCount, size_t theMaxAvailableCount, const WaitPolicy & theWaitPolicy )
         : takeConditionVar{}
         , giveConditionVar{}
         , mutex{}
@@ -52,12 +291,18 @@ public:
         , maxAvailableCount{ doctorMaxAvailableCount( theMaxAvailableCount, availableCount ) }
         , takePendingCount{ 0 }
         , givePendingCount{ 0 }
+        , takeMultiPendingCount{ 0 }
+        , giveMultiPendingCount{ 0 }
         , abortFlag{ false }
+        , waitPolicy{ theWaitPolicy }
+        , availableHint{ availableCount }
     {
-#ifdef REISER_RT_HAS_PTHREADS
-        // Initialize a condition variable attribute
+#if defined( REISER_RT_HAS_PTHREADS ) && !defined( REISER_RT_HAS_FUTEX_SEMAPHORE )
+        // Initialize a condition variable attribute. Timed waits are measured against CLOCK_MONOTONIC,
+        // the clock underlying std::chrono::steady_clock, rather than the adjustable system time.
         pthread_condattr_t attr;
         pthread_condattr_init( &attr );
+        pthread_condattr_setclock( &attr, CLOCK_MONOTONIC );
 
         // Initialize the condition variables
         pthread_cond_init( &takeConditionVar, &attr );
@@ -82,7 +327,7 @@ public:
         // Sleep a small amount to allow waiters on conditions to get out of the way.
         std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
 
-#ifdef REISER_RT_HAS_PTHREADS
+#if defined( REISER_RT_HAS_PTHREADS ) && !defined( REISER_RT_HAS_FUTEX_SEMAPHORE )
         // Destroy the condition variables.
         pthread_cond_destroy( &giveConditionVar );
         pthread_cond_destroy( &takeConditionVar );
@@ -137,7 +382,7 @@ public:
     */
     inline void take()
     {
-        std::unique_lock< Mutex > lock{mutex };
+        std::unique_lock< MutexType > lock{mutex };
         _take(lock);
         _takeNotify();
     }
@@ -156,26 +401,222 @@ public:
     * @throw The user operation may throw exceptions of unspecified type.
     */
     inline void take( const FunctionType & operation ) {
-        std::unique_lock< Mutex > lock{ mutex };
+        std::unique_lock< MutexType > lock{ mutex };
         _take(lock);
 
-        struct AvailableCountManager {
-            explicit AvailableCountManager( AvailableCountType & theAC ) noexcept : rAC(theAC)  {}
-            ~AvailableCountManager() noexcept { if ( !released ) ++rAC; }
+        // Guard the available count and call user provided operation.
+        AvailableCountManager availableCountManager{ availableCount, availableHint };
+        operation();
+        availableCountManager.release();
 
-            void release() { released = true; }
+        // Notify potential takers that could be waiting.
+        _takeNotify();
+    }
 
-            AvailableCountType & rAC;
-            bool released{ false };
-        };
+    /**
+    * @brief The Counted Take Operation
+    *
+    * This operation locks the mutex and invokes the _take operation to decrement the available count by count,
+    * all at once, followed by invoking the _takeNotify operation to wake any potential waiters on the give operation.
+    * The mutex is released upon return.
+    *
+    * @param count The count to take. If zero, we return immediately.
+    * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds the maximum available count.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    */
+    inline void take( size_t count )
+    {
+        if ( !_validateCount( count, "Semaphore::Imple::take: Count Exceeds Maximum Available Count!" ) ) return;
+
+        std::unique_lock< MutexType > lock{ mutex };
+        _take( lock, nullptr, count );
+        _takeNotify( count );
+    }
+
+    /**
+    * @brief The Counted Take Operation with Functor Interface
+    *
+    * This operation locks the mutex and invokes the _take operation to decrement the available count by count,
+    * all at once. Afterwards, it attempts to invoke the user provide function object, once.
+    * If the user function object should throw an exception, the available count is restored to its former state.
+    * Lastly, it invokes the _takeNotify operation to wake any potential waiters on the give operation.
+    * The mutex is unlocked upon return.
+    *
+    * @param operation This is a reference to a user provided function object to invoke during the context of the internal lock.
+    * @param count The count to take. If zero, we return immediately without invoking the user operation.
+    * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds the maximum available count.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    * @throw The user operation may throw exceptions of unspecified type.
+    */
+    inline void take( const FunctionType & operation, size_t count )
+    {
+        if ( !_validateCount( count, "Semaphore::Imple::take: Count Exceeds Maximum Available Count!" ) ) return;
+
+        std::unique_lock< MutexType > lock{ mutex };
+        _take( lock, nullptr, count );
 
         // Guard the available count and call user provided operation.
-        AvailableCountManager availableCountManager{ availableCount };
+        AvailableCountManager availableCountManager{ availableCount, availableHint, AvailableCountType( count ) };
+        operation();
+        availableCountManager.release();
+
+        // Notify potential givers that could be waiting.
+        _takeNotify( count );
+    }
+
+    /**
+    * @brief The Try Take Operation with Functor Interface
+    *
+    * This operation locks the mutex and, if the available count is non-zero, decrements it. Afterwards,
+    * it attempts to invoke the user provide function object. If the user function object should throw an exception,
+    * the available count is restored to its former state. Lastly, it invokes the _takeNotify operation to wake any
+    * potential waiters on the give operation. If the available count is zero, it returns immediately.
+    * The mutex is unlocked upon return.
+    *
+    * @param operation This is a reference to a user provided function object to invoke during the context of the internal lock.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation has been invoked.
+    * @throw The user operation may throw exceptions of unspecified type.
+    *
+    * @return Returns true if the available count was decremented and the user operation invoked, otherwise false.
+    */
+    inline bool tryTake( const FunctionType & operation )
+    {
+        std::unique_lock< MutexType > lock{ mutex };
+
+        // If the abort flag is set, throw a SemaphoreAborted exception.
+        if ( abortFlag ) throw SemaphoreAborted{ "Semaphore::Imple::tryTake: Semaphore Aborted!" };
+
+        // If there is nothing available, we do not wait.
+        if ( availableCount == 0 ) return false;
+        --availableCount;
+        _publish();
+
+        // Guard the available count and call user provided operation.
+        AvailableCountManager availableCountManager{ availableCount, availableHint };
+        operation();
+        availableCountManager.release();
+
+        // Notify potential takers that could be waiting.
+        _takeNotify();
+        return true;
+    }
+
+    /**
+    * @brief The Try Take Operation
+    *
+    * This operation locks the mutex and, if the available count is non-zero, decrements it and invokes the
+    * _takeNotify operation to wake any potential waiters on the give operation. If the available count is zero,
+    * it returns immediately. The mutex is unlocked upon return.
+    *
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation has been invoked.
+    *
+    * @return Returns true if the available count was decremented, otherwise false.
+    */
+    inline bool tryTake()
+    {
+        std::unique_lock< MutexType > lock{ mutex };
+
+        // If the abort flag is set, throw a SemaphoreAborted exception.
+        if ( abortFlag ) throw SemaphoreAborted{ "Semaphore::Imple::tryTake: Semaphore Aborted!" };
+
+        // If there is nothing available, we do not wait.
+        if ( availableCount == 0 ) return false;
+        --availableCount;
+        _publish();
+
+        // Notify potential givers that could be waiting.
+        _takeNotify();
+        return true;
+    }
+
+    /**
+    * @brief The Try Take Until Operation
+    *
+    * This operation locks the mutex and invokes the _take operation with a deadline. If the deadline passes
+    * before the available count can be decremented, it returns false. Otherwise, it invokes the _takeNotify
+    * operation to wake any potential waiters on the give operation. The mutex is unlocked upon return.
+    *
+    * @param deadline The steady clock time point after which we will no longer wait.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    *
+    * @return Returns true if the available count was decremented, otherwise false.
+    */
+    inline bool tryTakeUntil( const TimePointType & deadline )
+    {
+        std::unique_lock< MutexType > lock{ mutex };
+        if ( !_take( lock, &deadline ) ) return false;
+
+        // Notify potential givers that could be waiting.
+        _takeNotify();
+        return true;
+    }
+
+    /**
+    * @brief The Try Take Until Operation with Functor Interface
+    *
+    * This operation locks the mutex and invokes the _take operation with a deadline. If the deadline passes
+    * before the available count can be decremented, it returns false. Otherwise, it proceeds as the take
+    * operation with functor interface does. The mutex is unlocked upon return.
+    *
+    * @param operation This is a reference to a user provided function object to invoke during the context of the internal lock.
+    * @param deadline The steady clock time point after which we will no longer wait.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    * @throw The user operation may throw exceptions of unspecified type.
+    *
+    * @return Returns true if the available count was decremented and the user operation invoked, otherwise false.
+    */
+    inline bool tryTakeUntil( const FunctionType & operation, const TimePointType & deadline )
+    {
+        std::unique_lock< MutexType > lock{ mutex };
+        if ( !_take( lock, &deadline ) ) return false;
+
+        // Guard the available count and call user provided operation.
+        AvailableCountManager availableCountManager{ availableCount, availableHint };
         operation();
         availableCountManager.release();
 
         // Notify potential takers that could be waiting.
         _takeNotify();
+        return true;
+    }
+
+    /**
+    * @brief The Take Available Operation with Counted Functor Interface
+    *
+    * This operation locks the mutex and invokes the _take operation, which may block until the available count
+    * is non-zero. It then decrements the available count by as much more as is available, up to maxCount in total,
+    * and invokes the user provided function object once with the total count taken. If the user function object
+    * should throw an exception, the available count is restored to its former state. Lastly, it invokes the
+    * _takeNotify operation to wake any potential waiters on the give operation. The mutex is unlocked upon return.
+    *
+    * @param operation This is a reference to a user provided function object to invoke during the context of the internal lock.
+    * @param maxCount The maximum count to take. If zero, we return zero immediately.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    * @throw The user operation may throw exceptions of unspecified type.
+    *
+    * @return Returns the count taken.
+    */
+    inline size_t takeAvailable( const CountedFunctionType & operation, size_t maxCount )
+    {
+        if ( 0 == maxCount ) return 0;
+
+        std::unique_lock< MutexType > lock{ mutex };
+        _take( lock );
+
+        // We have taken one. Take whatever else is available, up to the maximum count.
+        const auto extraCount = AvailableCountType( std::min< size_t >( availableCount, maxCount - 1 ) );
+        availableCount -= extraCount;
+        _publish();
+        const AvailableCountType takenCount = extraCount + 1;
+
+        // Guard the available count and call user provided operation.
+        AvailableCountManager availableCountManager{ availableCount, availableHint, takenCount };
+        operation( takenCount );
+        availableCountManager.release();
+
+        // Notify potential givers that could be waiting.
+        _takeNotify( takenCount );
+        return takenCount;
     }
 
     /**
@@ -189,7 +630,7 @@ public:
     */
     inline void give()
     {
-        std::unique_lock< Mutex > lock{mutex };
+        std::unique_lock< MutexType > lock{mutex };
         _giveWait( lock );
         _give();
     }
@@ -208,12 +649,188 @@ public:
     */
     inline void give( const FunctionType & operation )
     {
-        std::unique_lock< Mutex > lock{mutex };
+        std::unique_lock< MutexType > lock{mutex };
         _giveWait( lock );
         operation();
         _give();
     }
 
+    /**
+    * @brief The Counted Give Operation
+    *
+    * This operation locks the mutex and invokes the _giveWait operation which may block until the available count
+    * may be incremented by count without exceeding the maxAvailableCount. Afterwards, it invokes the _give operation
+    * to increment it by count, all at once. The mutex is unlocked upon return.
+    *
+    * @param count The count to give. If zero, we return immediately.
+    * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds the maximum available count.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    */
+    inline void give( size_t count )
+    {
+        if ( !_validateCount( count, "Semaphore::Imple::give: Count Exceeds Maximum Available Count!" ) ) return;
+
+        std::unique_lock< MutexType > lock{ mutex };
+        _giveWait( lock, nullptr, count );
+        _give( count );
+    }
+
+    /**
+    * @brief The Counted Give Operation with Functor Interface
+    *
+    * This operation locks the mutex and invokes the _giveWait operation which may block until the available count
+    * may be incremented by count without exceeding the maxAvailableCount. Afterwards, it invokes the user provide
+    * operation, once. Should the user operation throw an exception the available count does not get incremented.
+    * Only after successfully invoking the user provided operation is the _give operation invoked to increment it by
+    * count, all at once. The mutex is unlocked upon return or if exception is thrown by the user provide operation.
+    *
+    * @param operation This is a reference to a user provided function object to invoke during the context of the internal lock.
+    * @param count The count to give. If zero, we return immediately without invoking the user operation.
+    * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds the maximum available count.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    */
+    inline void give( const FunctionType & operation, size_t count )
+    {
+        if ( !_validateCount( count, "Semaphore::Imple::give: Count Exceeds Maximum Available Count!" ) ) return;
+
+        std::unique_lock< MutexType > lock{ mutex };
+        _giveWait( lock, nullptr, count );
+        operation();
+        _give( count );
+    }
+
+    /**
+    * @brief The Try Give Operation with Functor Interface
+    *
+    * This operation locks the mutex and, if the maxAvailableCount would not be exceeded, invokes the user provide
+    * operation. Should the user operation throw an exception the available count does not get incremented. Only after
+    * successfully invoking the user provided operation is the _give operation invoked. If the maxAvailableCount would be
+    * exceeded, it returns immediately. The mutex is unlocked upon return or if exception is thrown by the user provide
+    * operation.
+    *
+    * @param operation This is a reference to a user provided function object to invoke during the context of the internal lock.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation has been invoked.
+    *
+    * @return Returns true if the user operation was invoked and the available count incremented, otherwise false.
+    */
+    inline bool tryGive( const FunctionType & operation )
+    {
+        std::unique_lock< MutexType > lock{mutex };
+
+        // If the abort flag is set, throw a SemaphoreAborted exception.
+        if ( abortFlag ) throw SemaphoreAborted{ "Semaphore::Imple::tryGive: Semaphore Aborted!" };
+
+        // If we cannot give without waiting, we do not wait. This also covers the absolute available count limit
+        // in unbounded mode, as the maxAvailableCount is that limit.
+        if ( maxAvailableCount <= availableCount ) return false;
+
+        operation();
+        _give();
+        return true;
+    }
+
+    /**
+    * @brief The Try Give Operation
+    *
+    * This operation locks the mutex and, if the maxAvailableCount would not be exceeded, invokes the _give
+    * operation. Otherwise, it returns immediately. The mutex is unlocked upon return.
+    *
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation has been invoked.
+    *
+    * @return Returns true if the available count was incremented, otherwise false.
+    */
+    inline bool tryGive()
+    {
+        std::unique_lock< MutexType > lock{ mutex };
+
+        // If the abort flag is set, throw a SemaphoreAborted exception.
+        if ( abortFlag ) throw SemaphoreAborted{ "Semaphore::Imple::tryGive: Semaphore Aborted!" };
+
+        // If we cannot give without waiting, we do not wait.
+        if ( maxAvailableCount <= availableCount ) return false;
+
+        _give();
+        return true;
+    }
+
+    /**
+    * @brief The Try Give Until Operation
+    *
+    * This operation locks the mutex and invokes the _giveWait operation with a deadline. If the deadline passes
+    * before the maxAvailableCount would no longer be exceeded, it returns false. Otherwise, it invokes the
+    * _give operation. The mutex is unlocked upon return.
+    *
+    * @param deadline The steady clock time point after which we will no longer wait.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    *
+    * @return Returns true if the available count was incremented, otherwise false.
+    */
+    inline bool tryGiveUntil( const TimePointType & deadline )
+    {
+        std::unique_lock< MutexType > lock{ mutex };
+        if ( !_giveWait( lock, &deadline ) ) return false;
+
+        _give();
+        return true;
+    }
+
+    /**
+    * @brief The Try Give Until Operation with Functor Interface
+    *
+    * This operation locks the mutex and invokes the _giveWait operation with a deadline. If the deadline passes
+    * before the maxAvailableCount would no longer be exceeded, it returns false. Otherwise, it proceeds as the give
+    * operation with functor interface does. The mutex is unlocked upon return or if exception is thrown by the
+    * user provided operation.
+    *
+    * @param operation This is a reference to a user provided function object to invoke during the context of the internal lock.
+    * @param deadline The steady clock time point after which we will no longer wait.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+    *
+    * @return Returns true if the user operation was invoked and the available count incremented, otherwise false.
+    */
+    inline bool tryGiveUntil( const FunctionType & operation, const TimePointType & deadline )
+    {
+        std::unique_lock< MutexType > lock{mutex };
+        if ( !_giveWait( lock, &deadline ) ) return false;
+
+        operation();
+        _give();
+        return true;
+    }
+
+    /**
+    * @brief The Give or Replace Operation with Functor Interface
+    *
+    * This operation locks the mutex and, if the maxAvailableCount would not be exceeded, invokes the user provided
+    * give operation followed by the _give operation. Otherwise, it invokes the user provided replace operation
+    * and leaves the available count unchanged. It never waits. The mutex is unlocked upon return or if an exception
+    * is thrown by either user provided operation.
+    *
+    * @param giveOperation This is a reference to a user provided function object to invoke if we can give.
+    * @param replaceOperation This is a reference to a user provided function object to invoke if we cannot.
+    * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation has been invoked.
+    *
+    * @return Returns true if the give operation was invoked and the available count incremented, otherwise false.
+    */
+    inline bool giveOrReplace( const FunctionType & giveOperation, const FunctionType & replaceOperation )
+    {
+        std::unique_lock< MutexType > lock{mutex };
+
+        // If the abort flag is set, throw a SemaphoreAborted exception.
+        if ( abortFlag ) throw SemaphoreAborted{ "Semaphore::Imple::giveOrReplace: Semaphore Aborted!" };
+
+        // If we cannot give without waiting, we replace instead.
+        if ( maxAvailableCount <= availableCount )
+        {
+            replaceOperation();
+            return false;
+        }
+
+        giveOperation();
+        _give();
+        return true;
+    }
+
     /**
     * @brief The Abort Operation
     *
@@ -223,7 +840,7 @@ public:
     */
     void abort()
     {
-        std::lock_guard< Mutex > lock( mutex );
+        std::lock_guard< MutexType > lock( mutex );
 
         // If the abort flag is set, quietly get out of the way.
         if ( abortFlag ) return;
@@ -231,14 +848,9 @@ public:
         // Set abort flag and wake up any and all waiters,
         abortFlag = true;
         if ( givePendingCount )
-            pthread_cond_broadcast( &giveConditionVar );
+            _notifyAll( giveConditionVar );
         if ( takePendingCount )
-#ifdef REISER_RT_HAS_PTHREADS
-            pthread_cond_broadcast( &takeConditionVar );
-#else
-        giveConditionVar.notify_all();
-        takeConditionVar.notify_all();
-#endif
+            _notifyAll( takeConditionVar );
     }
 
     /**
@@ -252,7 +864,7 @@ public:
     */
     size_t getAvailableCount()
     {
-        std::lock_guard< Mutex > lock( mutex );
+        std::lock_guard< MutexType > lock( mutex );
 
         return availableCount;
     }
@@ -261,18 +873,21 @@ private:
     /**
     * @brief The Take Notify Internals
     *
-    * This operation will notify at most, one waiting give thread.
+    * This operation will notify at most, one waiting give thread per count taken. When more than one was taken,
+    * or any waiting give thread awaits room for more than one, all waiting give threads are notified. Those that
+    * cannot give will simply wait again.
+    *
+    * @param takenCount The number of counts taken.
     */
-    inline void _takeNotify()
+    inline void _takeNotify( size_t takenCount = 1 )
     {
         // If we have any pending "givers", we must notify them.
         if ( givePendingCount )
         {
-#ifdef REISER_RT_HAS_PTHREADS
-            pthread_cond_signal( &giveConditionVar );
-#else
-            giveConditionVar.notify_one();
-#endif
+            if ( 1 == takenCount && 0 == giveMultiPendingCount )
+                _notifyOne( giveConditionVar );
+            else
+                _notifyAll( giveConditionVar );
         }
     }
 
@@ -285,38 +900,54 @@ private:
     * If the availableCount is zero, the takePendingCount is incremented and then the call blocks on our
     * takeConditionVar simultaneously unlocking the mutex until notified to unblock.
     * Once notified, the mutex is re-locked, the takePendingCount is decremented and we re-loop attempting to
-    * decrement the availableCount towards zero once more.
+    * decrement the availableCount towards zero once more. If a deadline is specified and it passes first,
+    * we give up without decrementing the availableCount. A count greater than one is decremented all at once,
+    * only when that much is available.
     *
+    * @param lock Our locked mutex.
+    * @param pDeadline A pointer to the steady clock deadline, or nullptr to wait indefinitely.
+    * @param count The count to take, which must not exceed maxAvailableCount.
     * @throw Throws ReiserRT::Core::SemaphoreAborted if the abortFlag has been set via the abort operation.
+    *
+    * @return Returns true if the availableCount was decremented and false if the deadline passed.
     */
-    void _take( std::unique_lock< Mutex > & lock )
+    bool _take( std::unique_lock< MutexType > & lock, const TimePointType * pDeadline = nullptr, size_t count = 1 )
     {
-#ifdef REISER_RT_HAS_PTHREADS
-        // The code involved with obtaining this native handle is largely or completely inlined
-        // and then significantly optimized away.
-        auto mutexNativeHandle = lock.mutex()->native_handle();
-#endif
+        bool spun = false;
         for (;;)
         {
             // If the abort flag is set, throw a SemaphoreAborted exception.
             if ( abortFlag ) throw SemaphoreAborted{ "Semaphore::Imple::_take: Semaphore Aborted!" };
 
-            // If the available count is greater than zero, decrement it and and escape out.
+            // If the available count is sufficient, decrement it and and escape out.
             // We have "taken" the semaphore.  Waiting is not necessary.
-            if ( availableCount > 0 )
+            if ( availableCount >= count )
+            {
+                availableCount -= AvailableCountType( count );
+                _publish();
+                return true;
+            }
+
+            // If our deadline has passed, we are done waiting.
+            if ( pDeadline && *pDeadline <= std::chrono::steady_clock::now() ) return false;
+
+            // If our wait policy has us poll first, do so once, then re-loop to find out whether it paid off.
+            if ( !spun )
             {
-                --availableCount;
-                break;
+                spun = true;
+                if ( !waitPolicy.isBlocking() )
+                {
+                    _poll( lock, pDeadline, [ this, count ]{ return availableHint.load( std::memory_order_relaxed ) >= count; } );
+                    continue;
+                }
             }
 
             // Else we must wait for a notification.
             ++takePendingCount;
-#ifdef REISER_RT_HAS_PTHREADS
-            pthread_cond_wait(&takeConditionVar, mutexNativeHandle );
-#else
-            takeConditionVar.wait( lock, [ this ]{ return abortFlag || availableCount > 0; } );
-#endif
-            // Awakened with test returning true.
+            if ( count > 1 ) ++takeMultiPendingCount;
+            _wait( takeConditionVar, lock, pDeadline );
+            // Awakened with test returning true, or timed out. Either way, we re-loop to find out which.
+            if ( count > 1 ) --takeMultiPendingCount;
             --takePendingCount;
         }
     }
@@ -325,15 +956,18 @@ private:
     * @brief The Give Wait Internals
     *
     * This operation will block if the maximum available count would be exceeded. We must wait for a take
-    * to catch up. It expects the mutex to be locked upon invocation.
+    * to catch up. It expects the mutex to be locked upon invocation. If a deadline is specified and it passes
+    * first, we give up. A count greater than one requires room for all of it.
+    *
+    * @param lock Our locked mutex.
+    * @param pDeadline A pointer to the steady clock deadline, or nullptr to wait indefinitely.
+    * @param count The count to give, which must not exceed maxAvailableCount.
+    *
+    * @return Returns true if we may give and false if the deadline passed.
     */
-    void _giveWait( std::unique_lock< Mutex > & lock )
+    bool _giveWait( std::unique_lock< MutexType > & lock, const TimePointType * pDeadline = nullptr, size_t count = 1 )
     {
-#ifdef REISER_RT_HAS_PTHREADS
-        // The code involved with obtaining this native handle is largely or completely inlined
-        // and then significantly optimized away.
-        auto mutexNativeHandle = lock.mutex()->native_handle();
-#endif
+        bool spun = false;
         for (;;)
         {
             // If the abort flag is set, throw a SemaphoreAborted exception.
@@ -341,23 +975,174 @@ private:
 
             // If we have already hit the numeric limits for available count, we cannot give anymore.
             // We will throw an exception.
-            if ( std::numeric_limits< AvailableCountType >::max() == availableCount )
+            if ( std::numeric_limits< AvailableCountType >::max() - availableCount < count )
                     throw SemaphoreOverflow{ "Semaphore::Imple::_giveWait: Absolute Available Count Limit Hit!" };
 
             // If we can avert a wait, we will do so.
-            if ( maxAvailableCount > availableCount )
-                break;
+            if ( maxAvailableCount - availableCount >= count )
+                return true;
+
+            // If our deadline has passed, we are done waiting.
+            if ( pDeadline && *pDeadline <= std::chrono::steady_clock::now() ) return false;
+
+            // If our wait policy has us poll first, do so once, then re-loop to find out whether it paid off.
+            if ( !spun )
+            {
+                spun = true;
+                if ( !waitPolicy.isBlocking() )
+                {
+                    _poll( lock, pDeadline, [ this, count ]
+                        { return maxAvailableCount - availableHint.load( std::memory_order_relaxed ) >= count; } );
+                    continue;
+                }
+            }
 
             // If here, we have to wait until we can "give" the Semaphore
             ++givePendingCount;
+            if ( count > 1 ) ++giveMultiPendingCount;
+            _wait( giveConditionVar, lock, pDeadline );
+            if ( count > 1 ) --giveMultiPendingCount;
+            --givePendingCount;
+        }
+    }
+
+    /**
+    * @brief The Validate Count Internals
+    *
+    * This operation validates the count given to a counted take or give operation. It does not require the mutex
+    * as the maxAvailableCount is constant.
+    *
+    * @param count The count to validate.
+    * @param msg The message to throw with should count exceed maxAvailableCount, which could never be satisfied.
+    * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds maxAvailableCount.
+    *
+    * @return Returns false if count is zero and there is nothing to do, otherwise true.
+    */
+    inline bool _validateCount( size_t count, const char * msg ) const
+    {
+        if ( count > maxAvailableCount ) throw SemaphoreOverflow{ msg };
+        return 0 != count;
+    }
 
-#ifdef REISER_RT_HAS_PTHREADS
-            pthread_cond_wait( &giveConditionVar, mutexNativeHandle );
+    /**
+    * @brief The Wait Internals
+    *
+    * This operation blocks upon a condition variable, simultaneously unlocking the mutex, until notified or,
+    * if specified, the deadline passes. The mutex is re-locked upon return. Spurious returns are possible.
+    * The caller must re-evaluate its condition.
+    *
+    * @param conditionVar The condition variable to wait upon.
+    * @param lock Our locked mutex.
+    * @param pDeadline A pointer to the steady clock deadline, or nullptr to wait indefinitely.
+    */
+    static void _wait( ConditionVarType & conditionVar, std::unique_lock< MutexType > & lock,
+                       const TimePointType * pDeadline )
+    {
+#if defined( REISER_RT_HAS_FUTEX_SEMAPHORE )
+        if ( pDeadline )
+        {
+            auto deadlineSpec = toTimeSpec( *pDeadline );
+            conditionVar.wait( lock, &deadlineSpec );
+        }
+        else
+            conditionVar.wait( lock, nullptr );
+#elif defined( REISER_RT_HAS_PTHREADS )
+        // The code involved with obtaining this native handle is largely or completely inlined
+        // and then significantly optimized away.
+        auto mutexNativeHandle = lock.mutex()->native_handle();
+        if ( pDeadline )
+        {
+            auto deadlineSpec = toTimeSpec( *pDeadline );
+            pthread_cond_timedwait( &conditionVar, mutexNativeHandle, &deadlineSpec );
+        }
+        else
+            pthread_cond_wait( &conditionVar, mutexNativeHandle );
 #else
-            giveConditionVar.wait( lock, [ this ]{ return abortFlag || availableCount > 0; } );
+        if ( pDeadline )
+            conditionVar.wait_until( lock, *pDeadline );
+        else
+            conditionVar.wait( lock );
 #endif
-            --givePendingCount;
+    }
+
+    /**
+    * @brief The Notify One Internals
+    *
+    * This operation wakes at most one thread waiting upon a condition variable.
+    *
+    * @param conditionVar The condition variable to notify.
+    */
+    static inline void _notifyOne( ConditionVarType & conditionVar )
+    {
+#if defined( REISER_RT_HAS_PTHREADS ) && !defined( REISER_RT_HAS_FUTEX_SEMAPHORE )
+        pthread_cond_signal( &conditionVar );
+#else
+        conditionVar.notify_one();
+#endif
+    }
+
+    /**
+    * @brief The Notify All Internals
+    *
+    * This operation wakes all threads waiting upon a condition variable.
+    *
+    * @param conditionVar The condition variable to notify.
+    */
+    static inline void _notifyAll( ConditionVarType & conditionVar )
+    {
+#if defined( REISER_RT_HAS_PTHREADS ) && !defined( REISER_RT_HAS_FUTEX_SEMAPHORE )
+        pthread_cond_broadcast( &conditionVar );
+#else
+        conditionVar.notify_all();
+#endif
+    }
+
+    /**
+    * @brief The Poll Internals
+    *
+    * This operation implements the polling phase of our wait policy. It expects the mutex to be locked upon
+    * invocation. It unlocks the mutex and busy polls the predicate, relaxing the processor between polls, up to
+    * spinCount times, and then yields between polls, up to yieldCount times. The mutex is re-locked upon return,
+    * whether the predicate became true, the budget was exhausted or, if specified, the deadline passed.
+    * The caller must re-evaluate its condition.
+    *
+    * @param lock Our locked mutex.
+    * @param pDeadline A pointer to the steady clock deadline, or nullptr to poll for the whole budget.
+    * @param predicate A predicate upon our availableHint, which may be evaluated without the mutex.
+    */
+    template< typename Predicate >
+    void _poll( std::unique_lock< MutexType > & lock, const TimePointType * pDeadline, Predicate predicate )
+    {
+        // We are done polling once the predicate is true, or our deadline has passed.
+        auto isDone = [ pDeadline, &predicate ]()
+        {
+            return predicate() || ( pDeadline && *pDeadline <= std::chrono::steady_clock::now() );
+        };
+
+        lock.unlock();
+        bool done = false;
+        for ( uint32_t i = 0; !done && waitPolicy.spinCount != i; ++i )
+        {
+            done = isDone();
+            if ( !done ) cpuRelax();
+        }
+        for ( uint32_t i = 0; !done && waitPolicy.yieldCount != i; ++i )
+        {
+            done = isDone();
+            if ( !done ) std::this_thread::yield();
         }
+        lock.lock();
+    }
+
+    /**
+    * @brief The Publish Internals
+    *
+    * This operation publishes the available count to threads polling without the mutex. It expects the mutex
+    * to be locked upon invocation.
+    */
+    inline void _publish() noexcept
+    {
+        availableHint.store( availableCount, std::memory_order_relaxed );
     }
 
     /**
@@ -365,23 +1150,30 @@ private:
     *
     * This operation is for internal use by the outer "give" operations.
     * It expects that our mutex has been acquired prior to invocation.
-    * The operation increments the availableCount and if takePendingCount is
+    * The operation increments the availableCount by count and if takePendingCount is
     * greater than zero, invokes the takeConditionVar, notify_one operation to wake one waiting thread.
+    * When more than one was given, or any waiting take thread awaits more than one, all waiting take
+    * threads are notified instead. Those that cannot take will simply wait again.
     *
+    * @param count The count to give.
     * @throw Throws ReiserRT::Core::SemaphoreAborted if the abortFlag has been set via the abort operation.
     */
-    void _give()
+    void _give( size_t count = 1 )
     {
         // If the abort flag is set, throw a SemaphoreAborted exception.
         if ( abortFlag ) throw SemaphoreAborted{ "Semaphore::Imple::_giveWait: Semaphore Aborted!" };
 
-        ++availableCount;
+        availableCount += AvailableCountType( count );
+        _publish();
 
-#ifdef REISER_RT_HAS_PTHREADS
-        pthread_cond_signal( &takeConditionVar );
-#else
-        takeConditionVar.notify_one();
-#endif
+        // If we have any pending "takers", we must notify them.
+        if ( takePendingCount )
+        {
+            if ( 1 == count && 0 == takeMultiPendingCount )
+                _notifyOne( takeConditionVar );
+            else
+                _notifyAll( takeConditionVar );
+        }
     }
 
     /**
@@ -392,6 +1184,32 @@ private:
     */
     using AvailableCountType = uint32_t;
 
+    /**
+    * @brief Available Count Manager
+    *
+    * This RAII helper restores a decremented available count, and its hint, upon destruction, unless released.
+    * It is used to guard the available count while a user provided operation is invoked after a take,
+    * should that operation throw an exception.
+    */
+    struct AvailableCountManager {
+        AvailableCountManager( AvailableCountType & theAC, std::atomic< AvailableCountType > & theHint,
+                               AvailableCountType theCount = 1 ) noexcept
+            : rAC(theAC), rHint(theHint), count(theCount) {}
+        ~AvailableCountManager() noexcept
+        {
+            if ( released ) return;
+            rAC += count;
+            rHint.store( rAC, std::memory_order_relaxed );
+        }
+
+        void release() { released = true; }
+
+        AvailableCountType & rAC;
+        std::atomic< AvailableCountType > & rHint;
+        AvailableCountType count;
+        bool released{ false };
+    };
+
     /**
     * @brief Pending 16bit Count Type
     *
@@ -424,17 +1242,6 @@ private:
         return theMaxAvailableCount;
     }
 
-    /**
-    * @brief Condition Variable Type
-    *
-    * The type of condition variable we are using.
-    */
-#ifdef REISER_RT_HAS_PTHREADS
-    using ConditionVarType = pthread_cond_t;
-#else
-    using ConditionVarType = std::condition_variable_any;
-#endif
-
     /**
     * @brief The Take Condition Variable
     *
@@ -454,7 +1261,7 @@ private:
     *
     * This is our mutual exclusion object used to synchronize access to our state attributes.
     */
-    Mutex mutex;
+    MutexType mutex;
 
     /**
     * @brief The Available Count
@@ -488,16 +1295,47 @@ private:
     */
     PendingCountType givePendingCount;
 
+    /**
+    * @brief The Take Multiple Pending Count
+    *
+    * This attribute indicates how many of those threads pending on takeConditionVar await a count greater than one.
+    */
+    PendingCountType takeMultiPendingCount;
+
+    /**
+    * @brief The Give Multiple Pending Count
+    *
+    * This attribute indicates how many of those threads pending on giveConditionVar await room for a count
+    * greater than one.
+    */
+    PendingCountType giveMultiPendingCount;
+
     /**
     * @brief The Abort Flag
     *
     * This attribute indicates that the abort operation has been invoked.
     */
     bool abortFlag;
+
+    /**
+    * @brief The Wait Policy
+    *
+    * This attribute specifies how take and give operations go about waiting.
+    */
+    const WaitPolicy waitPolicy;
+
+    /**
+    * @brief The Available Count Hint
+    *
+    * This attribute mirrors our available count for threads polling without the mutex, per our wait policy.
+    * It is only written with the mutex held. Pollers merely use it to decide when to re-take the mutex and
+    * re-evaluate the available count proper.
+    */
+    std::atomic< AvailableCountType > availableHint;
 };
 
-Semaphore::Semaphore( size_t theInitialCount, size_t theMaxAvailableCount )
-    : pImple{ new Semaphore::Imple{ theInitialCount, theMaxAvailableCount } }
+Semaphore::Semaphore( size_t theInitialCount, size_t theMaxAvailableCount, const WaitPolicy & theWaitPolicy )
+    : pImple{ new Semaphore::Imple{ theInitialCount, theMaxAvailableCount, theWaitPolicy } }
 {
 }
 
@@ -516,6 +1354,41 @@ void Semaphore::take( const FunctionType & operation )
     pImple->take( operation );
 }
 
+void Semaphore::take( size_t count )
+{
+    pImple->take( count );
+}
+
+void Semaphore::take( const FunctionType & operation, size_t count )
+{
+    pImple->take( operation, count );
+}
+
+bool Semaphore::tryTake()
+{
+    return pImple->tryTake();
+}
+
+bool Semaphore::tryTake( const FunctionType & operation )
+{
+    return pImple->tryTake( operation );
+}
+
+size_t Semaphore::takeAvailable( const CountedFunctionType & operation, size_t maxCount )
+{
+    return pImple->takeAvailable( operation, maxCount );
+}
+
+bool Semaphore::tryTakeUntil( const TimePointType & deadline )
+{
+    return pImple->tryTakeUntil( deadline );
+}
+
+bool Semaphore::tryTakeUntil( const FunctionType & operation, const TimePointType & deadline )
+{
+    return pImple->tryTakeUntil( operation, deadline );
+}
+
 void Semaphore::give( )
 {
     pImple->give();
@@ -526,6 +1399,41 @@ void Semaphore::give( const FunctionType & operation )
     pImple->give( operation );
 }
 
+void Semaphore::give( size_t count )
+{
+    pImple->give( count );
+}
+
+void Semaphore::give( const FunctionType & operation, size_t count )
+{
+    pImple->give( operation, count );
+}
+
+bool Semaphore::tryGive()
+{
+    return pImple->tryGive();
+}
+
+bool Semaphore::tryGive( const FunctionType & operation )
+{
+    return pImple->tryGive( operation );
+}
+
+bool Semaphore::tryGiveUntil( const TimePointType & deadline )
+{
+    return pImple->tryGiveUntil( deadline );
+}
+
+bool Semaphore::tryGiveUntil( const FunctionType & operation, const TimePointType & deadline )
+{
+    return pImple->tryGiveUntil( operation, deadline );
+}
+
+bool Semaphore::giveOrReplace( const FunctionType & giveOperation, const FunctionType & replaceOperation )
+{
+    return pImple->giveOrReplace( giveOperation, replaceOperation );
+}
+
 void Semaphore::abort()
 {
     pImple->abort();
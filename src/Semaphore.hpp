@@ -10,7 +10,10 @@
 
 #include "ReiserRT_CoreExport.h"
 
+#include "WaitPolicy.hpp"
+
 #include <functional>
+#include <chrono>
 #include <cstddef>
 
 namespace ReiserRT
@@ -31,7 +34,11 @@ namespace ReiserRT
         * point blocking occurs until a take is initiated. This second mode is referred to a bipolar operation.
         * This is perhaps unnatural but turns out to be extremely useful in producer/consumer patterns.
         *
-        * @todo Support timed give and take operations? Maybe some day.
+        * Timed take and give operations accept a deadline upon the steady clock. Under POSIX threads, our condition
+        * variables wait upon CLOCK_MONOTONIC, so that a deadline is immune to adjustments of the system time.
+        *
+        * A WaitPolicy may be specified at construction time. By default, waiting threads block at once. Otherwise,
+        * they first poll, without holding our lock, for the budget specified and only then block.
         */
         class ReiserRT_Core_EXPORT Semaphore
         {
@@ -55,6 +62,21 @@ namespace ReiserRT
             */
             using FunctionType = std::function< void() >;
 
+            /**
+            * @brief The Counted Function Type for take operations that may take more than one count.
+            *
+            * This is the type of functor expected by the takeAvailable operation. It is invoked once, while a lock
+            * is held, with the count taken. As with FunctionType, it should be a relatively simple, non-blocking operation.
+            */
+            using CountedFunctionType = std::function< void( size_t ) >;
+
+            /**
+            * @brief The Time Point Type for timed give and take operations.
+            *
+            * Deadlines are specified upon the steady clock which, under Linux, is CLOCK_MONOTONIC.
+            */
+            using TimePointType = std::chrono::steady_clock::time_point;
+
             /**
             * @brief Qualified Constructor for Semaphore
             *
@@ -65,10 +87,12 @@ namespace ReiserRT
             * @param theMaxAvailableCount The maximum Semaphore count. Zero indicates that the Semaphore
             * is essentially unbounded up to a maximum of (2^32-1). If non-zero, it is clamped to be no less than that
             * of the clamped initial count.
+            * @param theWaitPolicy The policy followed by take and give operations that must wait (@see WaitPolicy).
             * @note A non-zero value of theMaxAvailableCount specifies that the Semaphore operate in bipolar mode.
             * In essence, give operations will block if the available count would exceed the maximum specified.
             */
-            explicit Semaphore( size_t theInitialCount, size_t theMaxAvailableCount = 0 );
+            explicit Semaphore( size_t theInitialCount, size_t theMaxAvailableCount = 0,
+                                const WaitPolicy & theWaitPolicy = WaitPolicy{} );
 
             /**
             * @brief Destructor for the Semaphore
@@ -145,6 +169,165 @@ namespace ReiserRT
             */
             void take( const FunctionType & operation );
 
+            /**
+            * @brief The Counted Take Operation
+            *
+            * This operation decrements the available count by count, all at once under a single lock.
+            * If less than count is available, the operation will block until at least count is available.
+            *
+            * @param count The count to take. If zero, the operation returns immediately.
+            * @note A thread awaiting a large count may be overtaken by threads taking smaller counts.
+            * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds the maximum available count,
+            * as it could never be satisfied.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            */
+            void take( size_t count );
+
+            /**
+            * @brief The Counted Take Operation with Functor Interface
+            *
+            * This operation decrements the available count by count, all at once under a single lock, blocking
+            * until at least count is available. When it has done so, the user provided function object is invoked,
+            * once, while the internal lock is held.
+            *
+            * @param operation A reference to a user provided function object to be invoked after the availableCount is decremented.
+            * The user operation is invoked while an internal lock is held.
+            * @param count The count to take. If zero, the operation returns immediately without invoking the user operation.
+            * @warning Should the user operation throw an exception, the available count will be restored to its former state as if
+            * the take call was never invoked.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds the maximum available count,
+            * as it could never be satisfied.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            * @throw The user operation may throw an exception of unknown type.
+            */
+            void take( const FunctionType & operation, size_t count );
+
+            /**
+            * @brief The Try Take Operation with Functor Interface
+            *
+            * This operation attempts to decrement the available count towards zero without blocking.
+            * If the available count is already zero, the operation returns false immediately and the user
+            * provided function object is not invoked. Otherwise, it behaves as the take operation with functor
+            * interface does.
+            *
+            * @param operation A reference to a user provided function object to be invoked after the availableCount is decremented.
+            * The user operation is invoked while an internal lock is held.
+            * @warning Should the user operation throw an exception, the available count will be restored to its former state as if
+            * the tryTake call was never invoked.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the Semaphore has been aborted.
+            * @throw The user operation may throw an exception of unknown type.
+            *
+            * @return Returns true if the available count was decremented and the user operation invoked, otherwise false.
+            */
+            bool tryTake( const FunctionType & operation );
+
+            /**
+            * @brief The Try Take Operation
+            *
+            * This operation attempts to decrement the available count towards zero without blocking.
+            *
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the Semaphore has been aborted.
+            *
+            * @return Returns true if the available count was decremented, otherwise false.
+            */
+            bool tryTake();
+
+            /**
+            * @brief The Take Available Operation with Counted Functor Interface
+            *
+            * This operation blocks until the available count is non-zero, as the take operation does. It then
+            * decrements the available count by as much as is available, up to maxCount, all under one lock. The user
+            * provided function object is invoked once, while the lock is held, with the count taken. This affords a
+            * client the opportunity to consume many resources for the cost of a single take.
+            *
+            * @param operation A reference to a user provided function object to be invoked after the availableCount is decremented.
+            * The user operation is invoked while an internal lock is held.
+            * @param maxCount The maximum count to take. If zero, the operation returns zero immediately without blocking.
+            * @warning Should the user operation throw an exception, the available count will be restored to its former state as if
+            * the takeAvailable call was never invoked.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            * @throw The user operation may throw an exception of unknown type.
+            *
+            * @return Returns the count taken, which is at least one unless maxCount is zero.
+            */
+            size_t takeAvailable( const CountedFunctionType & operation, size_t maxCount );
+
+            /**
+            * @brief The Try Take Until Operation with Functor Interface
+            *
+            * This operation attempts to decrement the available count towards zero, blocking no later than the
+            * deadline specified. If the available count is still zero at the deadline, the operation returns false
+            * and the user provided function object is not invoked. Otherwise, it behaves as the take operation with
+            * functor interface does.
+            *
+            * @param operation A reference to a user provided function object to be invoked after the availableCount is decremented.
+            * The user operation is invoked while an internal lock is held.
+            * @param deadline The steady clock time point after which we will no longer wait.
+            * @warning Should the user operation throw an exception, the available count will be restored to its former state as if
+            * the tryTakeUntil call was never invoked.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            * @throw The user operation may throw an exception of unknown type.
+            *
+            * @return Returns true if the available count was decremented and the user operation invoked, otherwise false.
+            */
+            bool tryTakeUntil( const FunctionType & operation, const TimePointType & deadline );
+
+            /**
+            * @brief The Try Take Until Operation
+            *
+            * This operation attempts to decrement the available count towards zero, blocking no later than the
+            * deadline specified.
+            *
+            * @param deadline The steady clock time point after which we will no longer wait.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            *
+            * @return Returns true if the available count was decremented, otherwise false.
+            */
+            bool tryTakeUntil( const TimePointType & deadline );
+
+            /**
+            * @brief The Try Take For Operation
+            *
+            * This operation attempts to decrement the available count towards zero, blocking for no longer than
+            * the timeout specified. It is the relative form of the try take until operation.
+            *
+            * @param timeout The longest duration we will wait.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            *
+            * @return Returns true if the available count was decremented, otherwise false.
+            */
+            template< typename Rep, typename Period >
+            inline bool tryTakeFor( const std::chrono::duration< Rep, Period > & timeout )
+            {
+                return tryTakeUntil( deadlineFor( timeout ) );
+            }
+
+            /**
+            * @brief The Try Take For Operation with Functor Interface
+            *
+            * This operation is the relative form of the try take until operation with functor interface.
+            *
+            * @param operation A reference to a user provided function object to be invoked after the availableCount is decremented.
+            * The user operation is invoked while an internal lock is held.
+            * @param timeout The longest duration we will wait.
+            * @warning Should the user operation throw an exception, the available count will be restored to its former state as if
+            * the tryTakeFor call was never invoked.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            * @throw The user operation may throw an exception of unknown type.
+            *
+            * @return Returns true if the available count was decremented and the user operation invoked, otherwise false.
+            */
+            template< typename Rep, typename Period >
+            inline bool tryTakeFor( const FunctionType & operation, const std::chrono::duration< Rep, Period > & timeout )
+            {
+                return tryTakeUntil( operation, deadlineFor( timeout ) );
+            }
+
             /**
             * @brief The Give Operation
             *
@@ -177,6 +360,165 @@ namespace ReiserRT
             */
             void give( const FunctionType & operation );
 
+            /**
+            * @brief The Counted Give Operation
+            *
+            * This operation increments the available count by count, all at once under a single lock, and wakes
+            * waiting threads with a single notification rather than one per count. It may block if operating in
+            * bipolar mode until there is room for all of count.
+            *
+            * @param count The count to give. If zero, the operation returns immediately.
+            * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds the maximum available count,
+            * as it could never be satisfied, or if we have been notified more times than we can count (2^32 -1).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            */
+            void give( size_t count );
+
+            /**
+            * @brief The Counted Give Operation with Functor Interface
+            *
+            * This operation behaves as the counted give operation does. The user provided function object is invoked,
+            * once, while the internal lock is held, prior to incrementing the available count.
+            *
+            * @param operation A reference to a user provided function object to be invoked prior
+            * to the available count being incremented. The user operation is invoked while an internal lock is held.
+            * @param count The count to give. If zero, the operation returns immediately without invoking the user operation.
+            * @warning Should the user provided operation throw an exception, the availableCount is not incremented and no thread
+            * is awakened.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreOverflow if count exceeds the maximum available count,
+            * as it could never be satisfied, or if we have been notified more times than we can count (2^32 -1).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread.
+            */
+            void give( const FunctionType & operation, size_t count );
+
+            /**
+            * @brief The Try Give Operation with Functor Interface
+            *
+            * This operation attempts to increment the available count away from zero without blocking.
+            * If the maximum available count would be exceeded, the operation returns false immediately and the user
+            * provided function object is not invoked. Otherwise, it behaves as the give operation with functor
+            * interface does.
+            *
+            * @param operation A reference to a user provided function object to be invoked prior
+            * to the available count being incremented. The user operation is invoked while an internal lock is held.
+            * @warning Should the user provided operation throw an exception, the availableCount is not incremented and no thread
+            * is awakened.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the Semaphore has been aborted.
+            *
+            * @return Returns true if the user operation was invoked and the available count incremented, otherwise false.
+            */
+            bool tryGive( const FunctionType & operation );
+
+            /**
+            * @brief The Try Give Operation
+            *
+            * This operation attempts to increment the available count away from zero without blocking.
+            *
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the Semaphore has been aborted.
+            *
+            * @return Returns true if the available count was incremented, otherwise false.
+            */
+            bool tryGive();
+
+            /**
+            * @brief The Try Give Until Operation with Functor Interface
+            *
+            * This operation attempts to increment the available count away from zero, blocking no later than the
+            * deadline specified should the maximum available count be reached. If it would still be exceeded at the
+            * deadline, the operation returns false and the user provided function object is not invoked. Otherwise,
+            * it behaves as the give operation with functor interface does.
+            *
+            * @param operation A reference to a user provided function object to be invoked prior
+            * to the available count being incremented. The user operation is invoked while an internal lock is held.
+            * @param deadline The steady clock time point after which we will no longer wait.
+            * @warning Should the user provided operation throw an exception, the availableCount is not incremented and no thread
+            * is awakened.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread or if we have been
+            * notified more times than we can count (2^32 -1).
+            *
+            * @return Returns true if the user operation was invoked and the available count incremented, otherwise false.
+            */
+            bool tryGiveUntil( const FunctionType & operation, const TimePointType & deadline );
+
+            /**
+            * @brief The Try Give Until Operation
+            *
+            * This operation attempts to increment the available count away from zero, blocking no later than the
+            * deadline specified should the maximum available count be reached.
+            *
+            * @param deadline The steady clock time point after which we will no longer wait.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread or if we have been
+            * notified more times than we can count (2^32 -1).
+            *
+            * @return Returns true if the available count was incremented, otherwise false.
+            */
+            bool tryGiveUntil( const TimePointType & deadline );
+
+            /**
+            * @brief The Try Give For Operation
+            *
+            * This operation attempts to increment the available count away from zero, blocking for no longer than
+            * the timeout specified. It is the relative form of the try give until operation.
+            *
+            * @param timeout The longest duration we will wait.
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread or if we have been
+            * notified more times than we can count (2^32 -1).
+            *
+            * @return Returns true if the available count was incremented, otherwise false.
+            */
+            template< typename Rep, typename Period >
+            inline bool tryGiveFor( const std::chrono::duration< Rep, Period > & timeout )
+            {
+                return tryGiveUntil( deadlineFor( timeout ) );
+            }
+
+            /**
+            * @brief The Try Give For Operation with Functor Interface
+            *
+            * This operation is the relative form of the try give until operation with functor interface.
+            *
+            * @param operation A reference to a user provided function object to be invoked prior
+            * to the available count being incremented. The user operation is invoked while an internal lock is held.
+            * @param timeout The longest duration we will wait.
+            * @warning Should the user provided operation throw an exception, the availableCount is not incremented and no thread
+            * is awakened.
+            * @throw Throws std::bad_function_call if the operation passed in has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the abort operation is invoked via another thread or if we have been
+            * notified more times than we can count (2^32 -1).
+            *
+            * @return Returns true if the user operation was invoked and the available count incremented, otherwise false.
+            */
+            template< typename Rep, typename Period >
+            inline bool tryGiveFor( const FunctionType & operation, const std::chrono::duration< Rep, Period > & timeout )
+            {
+                return tryGiveUntil( operation, deadlineFor( timeout ) );
+            }
+
+            /**
+            * @brief The Give or Replace Operation with Functor Interface
+            *
+            * This operation never blocks on the maximum available count. If the available count may be incremented,
+            * it behaves as the try give operation with functor interface does, invoking the give operation.
+            * Otherwise, the replace operation is invoked instead and the available count is left unchanged.
+            * This supports resources which may displace one another when at capacity (e.g., a lossy ring buffer
+            * that evicts its oldest element to make room for a new one).
+            *
+            * @param giveOperation A reference to a user provided function object to be invoked prior
+            * to the available count being incremented. The user operation is invoked while an internal lock is held.
+            * @param replaceOperation A reference to a user provided function object to be invoked if the available
+            * count is at its maximum. The user operation is invoked while an internal lock is held.
+            * @warning Should the give operation throw an exception, the availableCount is not incremented and no thread
+            * is awakened.
+            * @throw Throws std::bad_function_call if the operation invoked has no target (an empty function object).
+            * @throw Throws ReiserRT::Core::SemaphoreAborted if the Semaphore has been aborted.
+            *
+            * @return Returns true if the give operation was invoked and false if the replace operation was invoked.
+            */
+            bool giveOrReplace( const FunctionType & giveOperation, const FunctionType & replaceOperation );
+
             /**
             * @brief The Abort Operation
             *
@@ -197,6 +539,30 @@ namespace ReiserRT
             size_t getAvailableCount();
 
         private:
+            /**
+            * @brief The Static Deadline For Operation
+            *
+            * This operation converts a timeout into a steady clock deadline from now, rounding up so that
+            * we never wait less than the timeout specified. A timeout too large to be represented as a deadline
+            * (e.g., std::chrono::hours::max()) saturates to TimePointType::max(), rather than overflowing.
+            *
+            * @param timeout The timeout to convert.
+            *
+            * @return Returns the steady clock deadline.
+            */
+            template< typename Rep, typename Period >
+            static TimePointType deadlineFor( const std::chrono::duration< Rep, Period > & timeout )
+            {
+                // We compare in floating point seconds as converting the timeout to our clock's duration may itself
+                // overflow. Within a second of the limit, a few centuries from now, is forever for all practical purposes.
+                using SecondsType = std::chrono::duration< double >;
+                const auto now = std::chrono::steady_clock::now();
+                if ( SecondsType( timeout ) >= SecondsType( TimePointType::max() - now ) - SecondsType( 1 ) )
+                    return TimePointType::max();
+
+                return now + std::chrono::ceil< std::chrono::steady_clock::duration >( timeout );
+            }
+
             /**
             * @brief Pointer Member to Hidden Implementation
             *
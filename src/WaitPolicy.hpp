@@ -0,0 +1,83 @@
+/**
+* @file WaitPolicy.hpp
+* @brief The Specification file for WaitPolicy
+*
+* This file came into existence because sleeping upon a condition variable, and being woken by the kernel, adds
+* several microseconds of latency to every hand-off. On isolated cores, busy polling for a short while first is
+* the better trade.
+*
+* @authors Frank Reiser
+* @date Created on Oct 16, 2026
+*/
+
+#ifndef REISERRT_CORE_WAITPOLICY_HPP
+#define REISERRT_CORE_WAITPOLICY_HPP
+
+#include <cstdint>
+
+namespace ReiserRT
+{
+    namespace Core
+    {
+        /**
+        * @brief The WaitPolicy Structure
+        *
+        * This structure specifies how a thread that must wait (e.g., a Semaphore take while unavailable) goes about it.
+        * It first busy polls, relaxing the processor between polls, up to spinCount times. It then yields the processor,
+        * polling after each, up to yieldCount times. Only then does it block. The default specifies blocking at once,
+        * as has always been done.
+        *
+        * @note Spinning only pays where the waker runs on another core. A spinning waiter occupies its core entirely.
+        */
+        struct WaitPolicy
+        {
+            uint32_t spinCount{ 0 };    //!< The number of busy polls before yielding.
+            uint32_t yieldCount{ 0 };   //!< The number of yielding polls before blocking.
+
+            /**
+            * @brief The Blocking Policy
+            *
+            * @return Returns a policy which blocks at once.
+            */
+            static constexpr WaitPolicy blocking() noexcept { return WaitPolicy{}; }
+
+            /**
+            * @brief The Spinning Policy
+            *
+            * @param theSpinCount The number of busy polls before yielding.
+            * @param theYieldCount The number of yielding polls before blocking.
+            *
+            * @return Returns a policy which spins, and then yields, before blocking.
+            */
+            static constexpr WaitPolicy spinning( uint32_t theSpinCount, uint32_t theYieldCount = 0 ) noexcept
+            {
+                return WaitPolicy{ theSpinCount, theYieldCount };
+            }
+
+            /**
+            * @brief Is Blocking Operation
+            *
+            * @return Returns true if this policy blocks without polling.
+            */
+            [[nodiscard]] constexpr bool isBlocking() const noexcept { return 0 == spinCount && 0 == yieldCount; }
+        };
+
+        /**
+        * @brief The CPU Relax Operation
+        *
+        * This operation hints to the processor that the invoking thread is busy polling (the x86 pause instruction,
+        * or the ARM yield instruction). This reduces power and yields pipeline resources to a sibling hyper-thread.
+        * Elsewhere, it does nothing.
+        */
+        inline void cpuRelax() noexcept
+        {
+#if defined( __x86_64__ ) || defined( __i386__ )
+            __builtin_ia32_pause();
+#elif defined( __aarch64__ ) || defined( __arm__ )
+            asm volatile( "yield" ::: "memory" );
+#endif
+        }
+    }
+}
+
+#endif /* REISERRT_CORE_WAITPOLICY_HPP */
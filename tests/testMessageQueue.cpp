@@ -3,11 +3,17 @@
 //
 
 #include "MessageQueue.hpp"
+#include "ReadinessEvent.hpp"
 
 #include <iostream>
 #include <random>
 #include <thread>
 #include <atomic>
+#include <vector>
+
+#include <poll.h>
+#include <sys/epoll.h>
+#include <unistd.h>
 
 using namespace std;
 using namespace ReiserRT::Core;
@@ -543,6 +549,160 @@ int main()
             }
         }
 
+        // Test the Single Dispatcher Feature. Messages sent from several threads are each dispatched once by
+        // the one thread dispatching. Any left behind are destroyed with the queue.
+        {
+            SimpleTestMessage::instanceCount = 0;
+            SimpleTestMessage::dispatchCount = 0;
+            {
+                MessageQueue msgQueue( 4, sizeof( SimpleTestMessage ), false, true );
+                constexpr size_t numProducers = 3;
+                constexpr size_t numMessagesEach = 10000;
+                vector< thread > producers;
+                for ( size_t i = 0; i != numProducers; ++i )
+                {
+                    producers.emplace_back( [ &msgQueue ](){
+                        for ( size_t n = 0; n != numMessagesEach; ++n ) msgQueue.put( SimpleTestMessage{} );
+                    } );
+                }
+                for ( size_t n = 0; n != numProducers * numMessagesEach; ++n ) msgQueue.getAndDispatch();
+                for ( auto & producer : producers ) producer.join();
+                if ( numProducers * numMessagesEach != SimpleTestMessage::dispatchCount )
+                {
+                    cout << "The single dispatcher dispatched " << SimpleTestMessage::dispatchCount << " messages. Expected "
+                         << numProducers * numMessagesEach << endl;
+                    retVal = 25;
+                    break;
+                }
+
+                // The instance count is not atomic. Start counting afresh, now that the producers are done.
+                SimpleTestMessage::instanceCount = 0;
+                msgQueue.put( SimpleTestMessage{} );
+                msgQueue.put( SimpleTestMessage{} );
+            }
+            if ( 0 != SimpleTestMessage::instanceCount )
+            {
+                cout << "The SimpleTestMessage::instanceCount is " << SimpleTestMessage::instanceCount
+                     << " after destroying a single dispatcher MessageQueue. Expected " << 0 << endl;
+                retVal = 26;
+                break;
+            }
+        }
+
+        // Test the Readiness File Descriptor Feature. Readable once a message is put, until drained by
+        // tryGetAndDispatch. One thread servicing two queues through epoll dispatches everything put into either.
+        {
+            SimpleTestMessage::instanceCount = 0;
+            SimpleTestMessage::dispatchCount = 0;
+
+            auto isReadable = []( int fd ) { pollfd pfd{ fd, POLLIN, 0 }; return 1 == poll( &pfd, 1, 0 ); };
+
+            MessageQueue msgQueue( 4, sizeof( SimpleTestMessage ), false, false, true );
+            if ( msgQueue.getReadinessFd() < 0 || isReadable( msgQueue.getReadinessFd() ) || msgQueue.tryGetAndDispatch() )
+            {
+                cout << "The readiness file descriptor of an empty MessageQueue should exist and not be readable" << endl;
+                retVal = 27;
+                break;
+            }
+            msgQueue.put( SimpleTestMessage{} );
+            msgQueue.put( SimpleTestMessage{} );
+            if ( !isReadable( msgQueue.getReadinessFd() ) )
+            {
+                cout << "The readiness file descriptor should be readable after a put" << endl;
+                retVal = 28;
+                break;
+            }
+            size_t numDispatched = 0;
+            while ( msgQueue.tryGetAndDispatch() ) ++numDispatched;
+            if ( 2 != numDispatched || 2 != SimpleTestMessage::dispatchCount || isReadable( msgQueue.getReadinessFd() ) )
+            {
+                cout << "The readiness file descriptor should not be readable after tryGetAndDispatch drains 2 messages" << endl;
+                retVal = 29;
+                break;
+            }
+
+            MessageQueue otherMsgQueue( 4, sizeof( SimpleTestMessage ), false, false, true );
+            const int epollFd = epoll_create1( EPOLL_CLOEXEC );
+            for ( auto * pMQ : { &msgQueue, &otherMsgQueue } )
+            {
+                epoll_event event{};
+                event.events = EPOLLIN;
+                event.data.ptr = pMQ;
+                epoll_ctl( epollFd, EPOLL_CTL_ADD, pMQ->getReadinessFd(), &event );
+            }
+            constexpr size_t numMessagesEach = 1000;
+            thread producer{ [ &msgQueue, &otherMsgQueue ](){
+                for ( size_t i = 0; i != numMessagesEach; ++i )
+                {
+                    msgQueue.put( SimpleTestMessage{} );
+                    otherMsgQueue.put( SimpleTestMessage{} );
+                }
+            } };
+            while ( SimpleTestMessage::dispatchCount != 2 + 2 * numMessagesEach )
+            {
+                epoll_event events[ 2 ];
+                const int n = epoll_wait( epollFd, events, 2, 5000 );
+                if ( n <= 0 ) break;
+                for ( int i = 0; i != n; ++i )
+                    while ( static_cast< MessageQueue * >( events[ i ].data.ptr )->tryGetAndDispatch() ) {}
+            }
+            producer.join();
+            close( epollFd );
+            if ( 2 + 2 * numMessagesEach != SimpleTestMessage::dispatchCount )
+            {
+                cout << "The epoll loop dispatched " << SimpleTestMessage::dispatchCount << " messages. Expected "
+                     << 2 + 2 * numMessagesEach << endl;
+                retVal = 30;
+                break;
+            }
+        }
+
+        // Test the Readiness Event where signal and clear interleave. A write racing a clear may land after it,
+        // leaving the file descriptor readable with nothing signaled. A clear must drain it regardless.
+        {
+            auto isReadable = []( int fd ) { pollfd pfd{ fd, POLLIN, 0 }; return 1 == poll( &pfd, 1, 0 ); };
+
+            ReadinessEvent readiness;
+            readiness.signal();
+            readiness.signal();
+            readiness.clear();
+            const bool clearedOnce = !isReadable( readiness.getFd() );
+            readiness.signal();
+            if ( !clearedOnce || !isReadable( readiness.getFd() ) )
+            {
+                cout << "The ReadinessEvent should be readable when signaled, and only then" << endl;
+                retVal = 31;
+                break;
+            }
+
+            // A late write, as a producer preempted between setting the flag and writing would make.
+            readiness.clear();
+            const uint64_t one = 1;
+            if ( sizeof( one ) != write( readiness.getFd(), &one, sizeof( one ) ) ) break;
+            readiness.clear();
+            if ( isReadable( readiness.getFd() ) )
+            {
+                cout << "The ReadinessEvent should not be readable after a clear following a late write" << endl;
+                retVal = 32;
+                break;
+            }
+
+            // Signal from one thread while clearing from another. Once both are done, a clear must suffice.
+            constexpr size_t numIterations = 100000;
+            thread signaler{ [ &readiness ](){
+                for ( size_t i = 0; i != numIterations; ++i ) readiness.signal();
+            } };
+            for ( size_t i = 0; i != numIterations; ++i ) readiness.clear();
+            signaler.join();
+            readiness.clear();
+            if ( isReadable( readiness.getFd() ) )
+            {
+                cout << "The ReadinessEvent should not be readable after interleaved signals and clears" << endl;
+                retVal = 33;
+                break;
+            }
+        }
+
 
 
         // Use an Active Class to test using Imple Pointers with Messages.
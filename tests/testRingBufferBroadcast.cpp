@@ -0,0 +1,173 @@
+//
+// Created by frank on 10/16/26.
+//
+
+#include "RingBufferBroadcast.hpp"
+
+#include <iostream>
+#include <thread>
+#include <atomic>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+namespace
+{
+    struct Sample
+    {
+        unsigned int value;
+        unsigned int stage;
+    };
+}
+
+int main()
+{
+    int retVal = 0;
+    do {
+        // Create a broadcast ring buffer with two independent consumers. Ask for 3, should get 4
+        RingBufferBroadcast<int> ringBuffer{ 3, 2 };
+        if ( ringBuffer.getSize() != 4 || ringBuffer.getNumConsumers() != 2 )
+        {
+            cout << "RingBufferBroadcast should have a reported size of 4 and has a size of " << ringBuffer.getSize() << endl;
+            retVal = 1;
+            break;
+        }
+
+        // Attempt to get on empty ring buffer.  It should throw.
+        try
+        {
+            ringBuffer.get( 0 );
+
+            // If we make it here, it failed.
+            cout << "RingBufferBroadcast should have thrown an exception on get attempt with empty ring buffer" << endl;
+            retVal = 2;
+            break;
+        }
+        catch (RingBufferUnderflow&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Fill it. Both consumers see every element.
+        for ( int i = 0; i != 4; ++i ) ringBuffer.put( i );
+        if ( ringBuffer.tryPut( 4 ) )
+        {
+            cout << "RingBufferBroadcast tryPut should have failed when full" << endl;
+            retVal = 3;
+            break;
+        }
+        for ( int i = 0; i != 4; ++i )
+        {
+            if ( ringBuffer.get( 0 ) != i )
+            {
+                cout << "RingBufferBroadcast consumer 0 should have got " << i << endl;
+                retVal = 4;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // The producer is gated by the slowest consumer. Consumer 1 has not consumed anything yet.
+        if ( ringBuffer.tryPut( 4 ) || ringBuffer.getAvailableCount( 1 ) != 4 )
+        {
+            cout << "RingBufferBroadcast producer should have been gated by consumer 1" << endl;
+            retVal = 5;
+            break;
+        }
+        auto rSpan = ringBuffer.peekSpan( 1, 4 );
+        if ( rSpan.size() != 4 || rSpan[ 0 ] != 0 || rSpan[ 3 ] != 3 )
+        {
+            cout << "RingBufferBroadcast consumer 1 peekSpan(4) should have returned all 4 elements" << endl;
+            retVal = 6;
+            break;
+        }
+        ringBuffer.release( 1, 2 );
+        if ( !ringBuffer.tryPut( 4 ) || !ringBuffer.tryPut( 5 ) || ringBuffer.tryPut( 6 ) )
+        {
+            cout << "RingBufferBroadcast producer should have had room for exactly 2 once consumer 1 released 2" << endl;
+            retVal = 7;
+            break;
+        }
+
+        // Dependencies. Cycles and out of range consumers are rejected.
+        try
+        {
+            RingBufferBroadcast<int> cyclic{ 4, 3 };
+            cyclic.addDependency( 1, 0 );
+            cyclic.addDependency( 2, 1 );
+            cyclic.addDependency( 0, 2 );
+
+            // If we make it here, it failed.
+            cout << "RingBufferBroadcast should have thrown an exception on a cyclic dependency" << endl;
+            retVal = 8;
+            break;
+        }
+        catch (RingBufferStateError&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // A dependent consumer only sees what its upstream consumer has consumed.
+        RingBufferBroadcast<int> pipeline{ 4, 2 };
+        pipeline.addDependency( 1, 0 );
+        pipeline.put( 42 );
+        if ( pipeline.tryGet( 1 ) || pipeline.get( 0 ) != 42 || pipeline.get( 1 ) != 42 )
+        {
+            cout << "RingBufferBroadcast consumer 1 should only see an element after consumer 0" << endl;
+            retVal = 9;
+            break;
+        }
+
+        // Now a producer feeding a three stage pipeline on separate threads. Stage 0 and stage 1 mark each sample
+        // in place. Stage 2 depends on both and verifies it sees every sample, in order, marked by both.
+        constexpr unsigned int numValues = 200000;
+        RingBufferBroadcast< Sample > threadedRingBuffer{ 256, 3 };
+        threadedRingBuffer.addDependency( 1, 0 );
+        threadedRingBuffer.addDependency( 2, 0 );
+        threadedRingBuffer.addDependency( 2, 1 );
+        atomic< bool > failed{ false };
+
+        auto stageTask = [&]( size_t consumer )
+        {
+            unsigned int expected = 0;
+            while ( expected != numValues && !failed )
+            {
+                auto span = threadedRingBuffer.peekSpan( consumer, 16 );
+                if ( span.empty() ) { this_thread::yield(); continue; }
+                for ( auto & sample : span )
+                {
+                    if ( sample.value != expected++ || sample.stage != consumer ) failed = true;
+                    ++sample.stage;
+                }
+                threadedRingBuffer.release( consumer, span.size() );
+            }
+        };
+
+        thread stage2{ stageTask, 2 };
+        thread stage1{ stageTask, 1 };
+        thread stage0{ stageTask, 0 };
+        thread producer{ [&]()
+        {
+            for ( unsigned int n = 0; n != numValues && !failed; )
+            {
+                if ( threadedRingBuffer.tryPut( Sample{ n, 0 } ) ) ++n;
+                else this_thread::yield();
+            }
+        } };
+
+        producer.join();
+        stage0.join();
+        stage1.join();
+        stage2.join();
+
+        if ( failed )
+        {
+            cout << "RingBufferBroadcast pipeline stage received a sample out of order or unmarked by its upstream stage" << endl;
+            retVal = 10;
+            break;
+        }
+
+    } while ( false );
+
+    return retVal;
+}
@@ -0,0 +1,199 @@
+//
+// Created by frank on 10/16/26.
+//
+
+#include "RingBufferFutexGuarded.hpp"
+
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+int main()
+{
+    int retVal = 0;
+    do {
+        // Create a ring buffer and verify that it has the correct size.  Ask for 3, should get 4
+        RingBufferFutexGuarded< int > ringBuffer{ 3 };
+        if ( ringBuffer.getSize() != 4 )
+        {
+            cout << "RingBufferFutexGuarded should have a reported size of 4 and has a size of " << ringBuffer.getSize() << endl;
+            retVal = 1;
+            break;
+        }
+
+        // Non-blocking operations report empty and full.
+        if ( ringBuffer.tryGet() )
+        {
+            cout << "RingBufferFutexGuarded tryGet should have reported empty" << endl;
+            retVal = 2;
+            break;
+        }
+        for ( int i = 0; i != 4; ++i ) ringBuffer.put( i );
+        if ( ringBuffer.tryPut( 4 ) )
+        {
+            cout << "RingBufferFutexGuarded tryPut should have reported full" << endl;
+            retVal = 3;
+            break;
+        }
+        for ( int i = 0; i != 4; ++i )
+        {
+            if ( ringBuffer.get() != i )
+            {
+                cout << "RingBufferFutexGuarded get should have returned " << i << endl;
+                retVal = 4;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // A consumer blocked on empty is woken by a put. A producer blocked on full is woken by a get.
+        {
+            atomic< int > got{ -1 };
+            thread consumer{ [ &ringBuffer, &got ](){ got = ringBuffer.get(); } };
+            this_thread::sleep_for( chrono::milliseconds{ 50 } );
+            ringBuffer.put( 42 );
+            consumer.join();
+            if ( got != 42 )
+            {
+                cout << "RingBufferFutexGuarded blocked get should have returned 42" << endl;
+                retVal = 5;
+                break;
+            }
+
+            for ( int i = 0; i != 4; ++i ) ringBuffer.put( i );
+            atomic< bool > putDone{ false };
+            thread producer{ [ &ringBuffer, &putDone ](){ ringBuffer.put( 4 ); putDone = true; } };
+            this_thread::sleep_for( chrono::milliseconds{ 50 } );
+            if ( putDone )
+            {
+                producer.join();
+                cout << "RingBufferFutexGuarded put should have blocked while full" << endl;
+                retVal = 6;
+                break;
+            }
+            ringBuffer.get();
+            producer.join();
+            for ( int i = 1; i != 5; ++i ) ringBuffer.get();
+        }
+
+        // Multiple producers and consumers, with a ring buffer small enough that both sides block often.
+        // Every value must arrive exactly once.
+        {
+            constexpr unsigned int numThreads = 4;
+            constexpr unsigned int numValuesPerProducer = 50000;
+            RingBufferFutexGuarded< unsigned int > mpmcRingBuffer{ 8 };
+            atomic< unsigned long long > sum{ 0 };
+            vector< thread > threads;
+            for ( unsigned int t = 0; t != numThreads; ++t )
+            {
+                threads.emplace_back( [ &mpmcRingBuffer ](){
+                    for ( unsigned int n = 1; n <= numValuesPerProducer; ++n ) mpmcRingBuffer.put( n );
+                } );
+                threads.emplace_back( [ &mpmcRingBuffer, &sum ](){
+                    unsigned long long localSum = 0;
+                    for ( unsigned int n = 0; n != numValuesPerProducer; ++n ) localSum += mpmcRingBuffer.get();
+                    sum += localSum;
+                } );
+            }
+            for ( auto & t : threads ) t.join();
+
+            const unsigned long long expected = numThreads * ( numValuesPerProducer * ( numValuesPerProducer + 1ULL ) / 2 );
+            if ( sum != expected )
+            {
+                cout << "RingBufferFutexGuarded consumers should have summed to " << expected << " and summed to " << sum << endl;
+                retVal = 7;
+                break;
+            }
+        }
+
+        // A single producer and consumer, served by RingBufferSPSC, must deliver every value in order.
+        {
+            constexpr unsigned int numValues = 200000;
+            RingBufferFutexGuarded< unsigned int, SingleProducer, SingleConsumer > spscRingBuffer{ 8 };
+            thread producer{ [ &spscRingBuffer ](){
+                for ( unsigned int n = 0; n != numValues; ++n ) spscRingBuffer.put( n );
+            } };
+            unsigned int n = 0;
+            for ( ; n != numValues; ++n )
+            {
+                if ( spscRingBuffer.get() != n ) break;
+            }
+            producer.join();
+            if ( n != numValues )
+            {
+                cout << "RingBufferFutexGuarded SingleProducer, SingleConsumer get should have returned " << n << endl;
+                retVal = 11;
+                break;
+            }
+        }
+
+        // Multiple producers with a single consumer. Every value must arrive exactly once.
+        {
+            constexpr unsigned int numThreads = 4;
+            constexpr unsigned int numValuesPerProducer = 50000;
+            RingBufferFutexGuarded< unsigned int, MultiProducer, SingleConsumer > mpscRingBuffer{ 8 };
+            vector< thread > producers;
+            for ( unsigned int t = 0; t != numThreads; ++t )
+            {
+                producers.emplace_back( [ &mpscRingBuffer ](){
+                    for ( unsigned int n = 1; n <= numValuesPerProducer; ++n ) mpscRingBuffer.put( n );
+                } );
+            }
+            unsigned long long sum = 0;
+            for ( unsigned int n = 0; n != numThreads * numValuesPerProducer; ++n ) sum += mpscRingBuffer.get();
+            for ( auto & t : producers ) t.join();
+
+            const unsigned long long expected = numThreads * ( numValuesPerProducer * ( numValuesPerProducer + 1ULL ) / 2 );
+            if ( sum != expected )
+            {
+                cout << "RingBufferFutexGuarded MultiProducer, SingleConsumer should have summed to " << expected << " and summed to " << sum << endl;
+                retVal = 12;
+                break;
+            }
+        }
+
+        // Abort wakes a blocked consumer, which throws, and subsequent puts get out of the way.
+        {
+            atomic< bool > threw{ false };
+            thread consumer{ [ &ringBuffer, &threw ](){
+                try { ringBuffer.get(); }
+                catch ( SemaphoreAborted & ) { threw = true; }
+            } };
+            this_thread::sleep_for( chrono::milliseconds{ 50 } );
+            ringBuffer.abort();
+            consumer.join();
+            if ( !threw )
+            {
+                cout << "RingBufferFutexGuarded blocked get should have thrown SemaphoreAborted on abort" << endl;
+                retVal = 8;
+                break;
+            }
+            ringBuffer.put( 1 );
+            if ( ringBuffer.tryPut( 2 ) )
+            {
+                cout << "RingBufferFutexGuarded tryPut should report failure once aborted" << endl;
+                retVal = 9;
+                break;
+            }
+        }
+
+        // Typed pointers are supported.
+        RingBufferFutexGuarded< const int * > ptrRingBuffer{ 2 };
+        const int anInt = 7;
+        ptrRingBuffer.put( &anInt );
+        if ( ptrRingBuffer.get() != &anInt )
+        {
+            cout << "RingBufferFutexGuarded typed pointer get should have returned the pointer put" << endl;
+            retVal = 10;
+            break;
+        }
+
+    } while ( false );
+
+    return retVal;
+}
@@ -10,6 +10,8 @@
 #include <memory>
 #include <vector>
 #include <thread>
+#include <chrono>
+#include <iterator>
 #include <iostream>
 
 using namespace std;
@@ -261,6 +263,397 @@ int main()
 
         }
 
+        // Small, trivially copyable records are stored inline, by value.
+        {
+            struct TimeStampedValue { uint64_t timeStamp; double value; };
+            RingBufferGuarded< TimeStampedValue > ringBuffer{ 4 };
+            for ( unsigned int i = 0; i != 4; ++i ) ringBuffer.put( { i, i * 0.5 } );
+            for ( unsigned int i = 0; i != 4; ++i )
+            {
+                auto tsv = ringBuffer.get();
+                if ( tsv.timeStamp != i || tsv.value != i * 0.5 )
+                {
+                    cout << "RingBufferGuarded< TimeStampedValue > get " << i << " returned the wrong record" << endl;
+                    retVal = 7;
+                    break;
+                }
+            }
+            if ( 0 != retVal ) break;
+        }
+
+        // Non-blocking operations. Empty and full are reported, neither blocking nor throwing.
+        {
+            RingBufferGuarded< int > ringBuffer{ 4 };
+            if ( ringBuffer.tryGet() )
+            {
+                cout << "RingBufferGuarded tryGet should have returned no value when empty" << endl;
+                retVal = 8;
+                break;
+            }
+            int i;
+            for ( i = 0; i != 10; ++i )
+            {
+                if ( !ringBuffer.tryPut( i ) ) break;
+            }
+            if ( i != 4 )
+            {
+                cout << "RingBufferGuarded tryPut should have failed on the 5th attempt.  Iterator got to a value of " << i << endl;
+                retVal = 9;
+                break;
+            }
+            for ( i = 0; i != 4; ++i )
+            {
+                auto v = ringBuffer.tryGet();
+                if ( !v || *v != i )
+                {
+                    cout << "RingBufferGuarded tryGet should have returned " << i << endl;
+                    retVal = 10;
+                    break;
+                }
+            }
+            if ( 0 != retVal ) break;
+
+            // Once aborted, tryPut gets out of the way as put does.
+            ringBuffer.abort();
+            if ( ringBuffer.tryPut( 0 ) )
+            {
+                cout << "RingBufferGuarded tryPut should have returned false after abort" << endl;
+                retVal = 11;
+                break;
+            }
+        }
+
+        // Overwrite mode. A full ring buffer evicts its oldest value and counts it as dropped.
+        // We request 3 to verify that our capacity is that requested and not the rounded up ring buffer size.
+        {
+            RingBufferGuarded< int > ringBuffer{ 3 };
+            for ( int i = 0; i != 5; ++i )
+            {
+                auto evicted = ringBuffer.putOverwrite( i );
+                if ( ( i < 3 && evicted ) || ( i >= 3 && ( !evicted || *evicted != i - 3 ) ) )
+                {
+                    cout << "RingBufferGuarded putOverwrite evicted unexpectedly on put of " << i << endl;
+                    retVal = 12;
+                    break;
+                }
+            }
+            if ( 0 != retVal ) break;
+            if ( ringBuffer.getDroppedCount() != 2 )
+            {
+                cout << "RingBufferGuarded should have reported a dropped count of 2 and reported " << ringBuffer.getDroppedCount() << endl;
+                retVal = 13;
+                break;
+            }
+            for ( int i = 2; i != 5; ++i )
+            {
+                auto v = ringBuffer.tryGet();
+                if ( !v || *v != i )
+                {
+                    cout << "RingBufferGuarded get after putOverwrite should have returned " << i << endl;
+                    retVal = 14;
+                    break;
+                }
+            }
+            if ( 0 != retVal ) break;
+            if ( ringBuffer.tryGet() )
+            {
+                cout << "RingBufferGuarded should be empty after getting all values put with putOverwrite" << endl;
+                retVal = 15;
+                break;
+            }
+        }
+
+        // Timed operations. Empty and full are waited upon no longer than the timeout, then reported.
+        {
+            RingBufferGuarded< int > ringBuffer{ 2 };
+            const auto start = chrono::steady_clock::now();
+            if ( ringBuffer.tryGetFor( chrono::milliseconds{ 20 } ) || chrono::steady_clock::now() - start < chrono::milliseconds{ 20 } )
+            {
+                cout << "RingBufferGuarded tryGetFor should have waited out its timeout and returned no value when empty" << endl;
+                retVal = 16;
+                break;
+            }
+            if ( !ringBuffer.tryPutFor( 1, chrono::milliseconds{ 20 } ) || !ringBuffer.putUntil( 2, chrono::steady_clock::now() ) ||
+                 ringBuffer.tryPutFor( 3, chrono::milliseconds{ 20 } ) )
+            {
+                cout << "RingBufferGuarded timed puts should have succeeded twice and then timed out when full" << endl;
+                retVal = 17;
+                break;
+            }
+
+            // A consumer waiting with a deadline is woken by a put.
+            ringBuffer.get();
+            ringBuffer.get();
+            int got = 0;
+            thread consumer{ [ &ringBuffer, &got ](){
+                got = ringBuffer.getUntil( chrono::steady_clock::now() + chrono::seconds{ 10 } ).value_or( -1 );
+            } };
+            this_thread::sleep_for( chrono::milliseconds{ 20 } );
+            ringBuffer.put( 42 );
+            consumer.join();
+            if ( got != 42 )
+            {
+                cout << "RingBufferGuarded getUntil should have been woken by a put and returned 42, returned " << got << endl;
+                retVal = 18;
+                break;
+            }
+
+            // A consumer waiting with a deadline is woken by abort.
+            bool threw = false;
+            thread abortedConsumer{ [ &ringBuffer, &threw ](){
+                try { ringBuffer.tryGetFor( chrono::seconds{ 10 } ); }
+                catch ( SemaphoreAborted & ) { threw = true; }
+            } };
+            this_thread::sleep_for( chrono::milliseconds{ 20 } );
+            ringBuffer.abort();
+            abortedConsumer.join();
+            if ( !threw )
+            {
+                cout << "RingBufferGuarded tryGetFor should have thrown SemaphoreAborted on abort" << endl;
+                retVal = 19;
+                break;
+            }
+        }
+
+        // Batch operations. Every value available is retrieved in order under a single semaphore take.
+        {
+            RingBufferGuarded< int > ringBuffer{ 8 };
+            for ( int i = 0; i != 5; ++i ) ringBuffer.put( i );
+            int values[ 8 ]{};
+            if ( ringBuffer.getUpTo( values, 3 ) != 3 || values[ 0 ] != 0 || values[ 2 ] != 2 )
+            {
+                cout << "RingBufferGuarded getUpTo should have retrieved 0 through 2" << endl;
+                retVal = 20;
+                break;
+            }
+            vector< int > all;
+            if ( ringBuffer.getAll( back_inserter( all ) ) != 2 || all.size() != 2 || all[ 0 ] != 3 || all[ 1 ] != 4 ||
+                 ringBuffer.tryGet() )
+            {
+                cout << "RingBufferGuarded getAll should have retrieved 3 and 4, leaving the ring buffer empty" << endl;
+                retVal = 21;
+                break;
+            }
+
+            // A full ring buffer drained in one batch makes room for a blocked producer.
+            for ( int i = 0; i != 8; ++i ) ringBuffer.put( i );
+            thread producer{ [ &ringBuffer ](){ ringBuffer.put( 8 ); } };
+            this_thread::sleep_for( chrono::milliseconds{ 20 } );
+            all.clear();
+            size_t count = ringBuffer.getAll( back_inserter( all ) );
+            producer.join();
+            count += ringBuffer.getAll( back_inserter( all ) );
+            if ( count != 9 || all.size() != 9 || all.back() != 8 )
+            {
+                cout << "RingBufferGuarded getAll should have retrieved 9 values across two batches, retrieved " << count << endl;
+                retVal = 22;
+                break;
+            }
+
+            // Typed pointers are supported.
+            RingBufferGuarded< const int * > ptrRingBuffer{ 4 };
+            ptrRingBuffer.put( &values[ 0 ] );
+            ptrRingBuffer.put( &values[ 1 ] );
+            const int * ptrs[ 4 ]{};
+            if ( ptrRingBuffer.getUpTo( ptrs, 4 ) != 2 || ptrs[ 0 ] != &values[ 0 ] || ptrs[ 1 ] != &values[ 1 ] )
+            {
+                cout << "RingBufferGuarded typed pointer getUpTo should have retrieved the pointers put" << endl;
+                retVal = 23;
+                break;
+            }
+        }
+
+        // A spinning wait policy. Hand-offs in both directions must neither lose nor reorder values,
+        // whether the waiter found its value while polling or had to block.
+        {
+            RingBufferGuarded< unsigned int > ringBuffer{ 4, false, WaitPolicy::spinning( 1000, 10 ) };
+            constexpr unsigned int numValues = 100000;
+            thread producer{ [ &ringBuffer ](){
+                for ( unsigned int n = 0; n != numValues; ++n ) ringBuffer.put( n );
+            } };
+            unsigned int n = 0;
+            for ( ; n != numValues; ++n )
+            {
+                if ( ringBuffer.get() != n ) break;
+            }
+            producer.join();
+            if ( n != numValues )
+            {
+                cout << "RingBufferGuarded with a spinning wait policy should have returned " << n << endl;
+                retVal = 24;
+                break;
+            }
+
+            // Abort still wakes a waiter, once polling has given up.
+            bool threw = false;
+            thread consumer{ [ &ringBuffer, &threw ](){
+                try { ringBuffer.get(); }
+                catch ( SemaphoreAborted & ) { threw = true; }
+            } };
+            this_thread::sleep_for( chrono::milliseconds{ 20 } );
+            ringBuffer.abort();
+            consumer.join();
+            if ( !threw )
+            {
+                cout << "RingBufferGuarded with a spinning wait policy should have thrown SemaphoreAborted on abort" << endl;
+                retVal = 25;
+                break;
+            }
+        }
+
+        // A single producer and a single consumer access the ring buffer outside of the semaphore's lock.
+        // Hand-offs must neither lose nor reorder values, whichever operations are mixed.
+        {
+            RingBufferGuarded< unsigned int, SingleProducer, SingleConsumer > ringBuffer{ 4 };
+            constexpr unsigned int numValues = 100000;
+            thread producer{ [ &ringBuffer ](){
+                for ( unsigned int n = 0; n != numValues; ++n )
+                {
+                    if ( n & 1 ) ringBuffer.put( n );
+                    else while ( !ringBuffer.tryPutFor( n, chrono::milliseconds{ 10 } ) ) {}
+                }
+            } };
+            unsigned int n = 0;
+            unsigned int values[ 4 ]{};
+            while ( n != numValues )
+            {
+                if ( n % 3 == 0 )
+                {
+                    const size_t count = ringBuffer.getUpTo( values, 4 );
+                    size_t i = 0;
+                    for ( ; count != i && values[ i ] == n; ++i, ++n ) {}
+                    if ( count != i ) break;
+                }
+                else if ( ringBuffer.get() != n++ ) break;
+            }
+            producer.join();
+            if ( n != numValues )
+            {
+                cout << "RingBufferGuarded single producer and consumer should have returned " << n << endl;
+                retVal = 26;
+                break;
+            }
+
+            // Capacity is as requested, the spare elements notwithstanding.
+            unsigned int puts = 0;
+            while ( ringBuffer.tryPut( puts ) ) ++puts;
+            auto val = ringBuffer.tryGet();
+            if ( puts != 4 || !val || *val != 0 || !ringBuffer.tryPut( 4 ) || ringBuffer.tryPut( 5 ) ||
+                 ringBuffer.getAll( values ) != 4 || values[ 0 ] != 1 || values[ 3 ] != 4 || ringBuffer.tryGet() )
+            {
+                cout << "RingBufferGuarded single producer and consumer should hold 4, held " << puts << endl;
+                retVal = 27;
+                break;
+            }
+        }
+
+        // Multiple producers to a single consumer. Each producer's values must arrive in the order put.
+        {
+            RingBufferGuarded< unsigned int, MultiProducer, SingleConsumer > ringBuffer{ 8 };
+            constexpr unsigned int numProducers = 4;
+            constexpr unsigned int numValues = 50000;
+            vector< thread > producers;
+            for ( unsigned int p = 0; p != numProducers; ++p )
+            {
+                producers.emplace_back( [ &ringBuffer, p ](){
+                    for ( unsigned int n = 0; n != numValues; ++n ) ringBuffer.put( ( p << 24 ) | n );
+                } );
+            }
+            unsigned int nextValues[ numProducers ]{};
+            unsigned int n = 0;
+            for ( ; n != numProducers * numValues; ++n )
+            {
+                const auto val = ringBuffer.get();
+                if ( ( val & 0xFFFFFF ) != nextValues[ val >> 24 ]++ ) break;
+            }
+            for ( auto & producer : producers ) producer.join();
+            if ( n != numProducers * numValues )
+            {
+                cout << "RingBufferGuarded multiple producers to a single consumer should have returned " << n << endl;
+                retVal = 28;
+                break;
+            }
+        }
+
+        // A single producer to multiple consumers. Each consumer's values must be in the order put, none lost.
+        {
+            RingBufferGuarded< unsigned int, SingleProducer, MultiConsumer > ringBuffer{ 8 };
+            constexpr unsigned int numConsumers = 4;
+            constexpr unsigned int numValues = 200000;
+            bool ordered[ numConsumers ]{};
+            unsigned int counts[ numConsumers ]{};
+            vector< thread > consumers;
+            for ( unsigned int c = 0; c != numConsumers; ++c )
+            {
+                consumers.emplace_back( [ &ringBuffer, &ordered, &counts, c ](){
+                    ordered[ c ] = true;
+                    auto val = ringBuffer.get();
+                    for ( unsigned int last = 0; val; ++counts[ c ] )
+                    {
+                        if ( val <= last ) ordered[ c ] = false;
+                        last = val;
+                        val = ringBuffer.get();
+                    }
+                } );
+            }
+            for ( unsigned int n = 1; n != numValues + 1; ++n ) ringBuffer.put( n );
+            for ( unsigned int c = 0; c != numConsumers; ++c ) ringBuffer.put( 0 );
+            for ( auto & consumer : consumers ) consumer.join();
+            unsigned int total = 0;
+            for ( unsigned int c = 0; c != numConsumers; ++c )
+            {
+                if ( !ordered[ c ] ) total = ~0U;
+                else if ( total != ~0U ) total += counts[ c ];
+            }
+            if ( total != numValues )
+            {
+                cout << "RingBufferGuarded single producer to multiple consumers should have returned " << numValues
+                     << " values in order" << endl;
+                retVal = 29;
+                break;
+            }
+
+            // Overwriting evicts the oldest value.
+            for ( unsigned int n = 0; n != 8; ++n ) ringBuffer.put( n );
+            auto evicted = ringBuffer.putOverwrite( 8 );
+            if ( !evicted || *evicted != 0 || ringBuffer.get() != 1 || ringBuffer.getDroppedCount() != 1 )
+            {
+                cout << "RingBufferGuarded single producer overwrite should have evicted 0" << endl;
+                retVal = 30;
+                break;
+            }
+        }
+
+        // Typed pointers are supported with single producer and consumer policies.
+        {
+            RingBufferGuarded< const int *, SingleProducer, SingleConsumer > ringBuffer{ 2 };
+            const int values[ 2 ]{};
+            ringBuffer.put( &values[ 0 ] );
+            const bool putSecond = ringBuffer.putUntil( &values[ 1 ], chrono::steady_clock::now() );
+            const auto first = ringBuffer.get();
+            const auto second = ringBuffer.getUntil( chrono::steady_clock::now() );
+            if ( !putSecond || first != &values[ 0 ] || !second || *second != &values[ 1 ] ||
+                 ringBuffer.tryGetFor( chrono::milliseconds{ 1 } ) )
+            {
+                cout << "RingBufferGuarded typed pointer single producer and consumer should have retrieved the pointers put" << endl;
+                retVal = 31;
+                break;
+            }
+        }
+
+        // A timed get honours its deadline, however large the polling budget of the wait policy.
+        {
+            RingBufferGuarded< unsigned int > ringBuffer{ 4, false, WaitPolicy::spinning( 2000000000 ) };
+            const auto start = chrono::steady_clock::now();
+            if ( ringBuffer.tryGetFor( chrono::milliseconds{ 10 } ) ||
+                 chrono::steady_clock::now() - start > chrono::milliseconds{ 500 } )
+            {
+                cout << "RingBufferGuarded tryGetFor should have timed out near its deadline while spinning" << endl;
+                retVal = 32;
+                break;
+            }
+        }
+
     } while ( false );
 
     return retVal;
@@ -0,0 +1,129 @@
+//
+// Created by frank on 10/16/26.
+//
+
+#include "RingBufferHistory.hpp"
+
+#include <iostream>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+int main()
+{
+    using History = RingBufferHistory< int >;
+    using TimePoint = History::TimePoint;
+    auto ms = []( int n ){ return TimePoint{ chrono::milliseconds{ n } }; };
+
+    int retVal = 0;
+    do {
+        // Create a history and verify that it has the correct size.  Ask for 7, should get 8
+        History history{ 7 };
+        if ( history.getSize() != 8 )
+        {
+            cout << "RingBufferHistory should have a reported size of 8 and has a size of " << history.getSize() << endl;
+            retVal = 1;
+            break;
+        }
+
+        // Lookups into an empty history find nothing.
+        if ( history.getAtOrBefore( ms( 100 ) ) || !history.getSince( ms( 0 ) ).empty() || history.getNewest() )
+        {
+            cout << "RingBufferHistory lookups into an empty history should have found nothing" << endl;
+            retVal = 2;
+            break;
+        }
+
+        // Record 20 entries, one per millisecond, so that the oldest 12 are overwritten and the indices wrap.
+        for ( int i = 0; i != 20; ++i ) history.put( ms( i ), i * 10 );
+        if ( history.getAvailableCount() != 8 || history.end() - history.begin() != 8 || history.begin()[ 3 ].value != 150 )
+        {
+            cout << "RingBufferHistory should hold the newest 8 entries" << endl;
+            retVal = 3;
+            break;
+        }
+
+        // Entry at or before a time point between entries.
+        auto entry = history.getAtOrBefore( ms( 15 ) + chrono::microseconds{ 500 } );
+        if ( !entry || entry->value != 150 || entry->time != ms( 15 ) )
+        {
+            cout << "RingBufferHistory getAtOrBefore should have found the entry at 15 ms" << endl;
+            retVal = 4;
+            break;
+        }
+
+        // Entry at or before a time point exactly on an entry, and after the newest.
+        if ( history.getAtOrBefore( ms( 12 ) )->value != 120 || history.getAtOrBefore( ms( 1000 ) )->value != 190 )
+        {
+            cout << "RingBufferHistory getAtOrBefore should have found the entries at 12 ms and 19 ms" << endl;
+            retVal = 5;
+            break;
+        }
+
+        // Entries before the oldest have been overwritten.
+        if ( history.getAtOrBefore( ms( 11 ) ) )
+        {
+            cout << "RingBufferHistory getAtOrBefore should not have found an overwritten entry" << endl;
+            retVal = 6;
+            break;
+        }
+
+        // All entries within the last 2 ms of the newest.
+        auto window = history.getLast( chrono::milliseconds{ 2 }, ms( 19 ) );
+        int expected = 17;
+        for ( const auto & e : window )
+        {
+            if ( e.value != expected++ * 10 ) retVal = 7;
+        }
+        if ( 0 != retVal || window.size() != 3 || expected != 20 )
+        {
+            cout << "RingBufferHistory getLast should have found the entries at 17 through 19 ms" << endl;
+            retVal = 7;
+            break;
+        }
+
+        // A window reaching back before the oldest entry holds everything.
+        if ( history.getSince( ms( 0 ) ).size() != 8 || !history.getSince( ms( 20 ) ).empty() )
+        {
+            cout << "RingBufferHistory getSince returned an unexpected window size" << endl;
+            retVal = 8;
+            break;
+        }
+
+        // Time may stand still but must not go backwards.
+        history.put( ms( 19 ), 191 );
+        if ( history.getNewest()->value != 191 )
+        {
+            cout << "RingBufferHistory getNewest should have returned 191" << endl;
+            retVal = 9;
+            break;
+        }
+        try
+        {
+            history.put( ms( 18 ), 0 );
+
+            // If we make it here, it failed.
+            cout << "RingBufferHistory should have thrown an exception on put of an earlier time point" << endl;
+            retVal = 10;
+            break;
+        }
+        catch (RingBufferStateError&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // A compile time capacity history stamped by its clock.
+        RingBufferHistory< float, 4 > nowHistory{};
+        for ( int i = 0; i != 6; ++i ) nowHistory.put( float( i ) );
+        auto recent = nowHistory.getLast( chrono::hours{ 1 } );
+        if ( recent.size() != 4 || recent.begin()->value != 2.0f || nowHistory.getNewest()->value != 5.0f )
+        {
+            cout << "RingBufferHistory stamped by its clock should have held the newest 4 entries" << endl;
+            retVal = 11;
+            break;
+        }
+
+    } while ( false );
+
+    return retVal;
+}
@@ -0,0 +1,188 @@
+//
+// Created by frank on 10/16/26.
+//
+
+#include "RingBufferJournal.hpp"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+namespace
+{
+    struct Record
+    {
+        uint32_t sequence;
+        float value;
+    };
+
+    vector< uint32_t > replayAll( const char * path, uint64_t fromCount = 0, uint64_t * pNextCount = nullptr )
+    {
+        vector< uint32_t > sequences{};
+        RingBufferJournalReader< Record > reader{ path };
+        auto nextCount = reader.replay( [ &sequences ]( const Record & r ){ sequences.push_back( r.sequence ); }, fromCount );
+        if ( pNextCount ) *pNextCount = nextCount;
+        return sequences;
+    }
+
+    bool isSequence( const vector< uint32_t > & sequences, uint32_t first, uint32_t last )
+    {
+        if ( sequences.size() != last - first + 1 ) return false;
+        for ( size_t i = 0; i != sequences.size(); ++i )
+        {
+            if ( sequences[ i ] != first + i ) return false;
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    const string path = "/tmp/ReiserRT_testRingBufferJournal_" + to_string( getpid() );
+    unlink( path.c_str() );
+
+    int retVal = 0;
+    do {
+        // Create a journal and verify that it has the correct size.  Ask for 7, should get 8
+        {
+            RingBufferJournal< Record > journal{ path.c_str(), 7 };
+            if ( journal.getSize() != 8 )
+            {
+                cout << "RingBufferJournal should have a reported size of 8 and has a size of " << journal.getSize() << endl;
+                retVal = 1;
+                break;
+            }
+
+            // Put fewer records than it holds.
+            for ( uint32_t i = 0; i != 3; ++i ) journal.put( Record{ i, float( i ) } );
+            journal.sync( true );
+        }
+
+        // Replay them after the journal has been closed.
+        if ( !isSequence( replayAll( path.c_str() ), 0, 2 ) )
+        {
+            cout << "RingBufferJournalReader should have replayed records 0 through 2" << endl;
+            retVal = 2;
+            break;
+        }
+
+        // Reopen the journal and put more records than it holds. The oldest are overwritten.
+        {
+            RingBufferJournal< Record > journal{ path.c_str(), 8 };
+            if ( journal.getPutCount() != 3 )
+            {
+                cout << "RingBufferJournal reopened should have resumed at a put count of 3 and has " << journal.getPutCount() << endl;
+                retVal = 3;
+                break;
+            }
+            for ( uint32_t i = 3; i != 20; ++i ) journal.put( Record{ i, float( i ) } );
+            if ( journal.getAvailableCount() != 8 )
+            {
+                cout << "RingBufferJournal should hold 8 records and holds " << journal.getAvailableCount() << endl;
+                retVal = 4;
+                break;
+            }
+        }
+
+        uint64_t nextCount = 0;
+        if ( !isSequence( replayAll( path.c_str(), 0, &nextCount ), 12, 19 ) || nextCount != 20 )
+        {
+            cout << "RingBufferJournalReader should have replayed records 12 through 19" << endl;
+            retVal = 5;
+            break;
+        }
+
+        // Follow a live journal. A reader replays only records put since its last replay.
+        {
+            RingBufferJournal< Record > journal{ path.c_str(), 8 };
+            RingBufferJournalReader< Record > reader{ path.c_str() };
+            for ( uint32_t i = 20; i != 23; ++i ) journal.put( Record{ i, float( i ) } );
+
+            vector< uint32_t > sequences{};
+            nextCount = reader.replay( [ &sequences ]( const Record & r ){ sequences.push_back( r.sequence ); }, nextCount );
+            if ( !isSequence( sequences, 20, 22 ) || nextCount != 23 )
+            {
+                cout << "RingBufferJournalReader should have replayed records 20 through 22 only" << endl;
+                retVal = 6;
+                break;
+            }
+        }
+
+        // Reopening with a different capacity must be refused.
+        try
+        {
+            RingBufferJournal< Record > incompatible{ path.c_str(), 16 };
+
+            // If we make it here, it failed.
+            cout << "RingBufferJournal should have thrown an exception reopening with a different capacity" << endl;
+            retVal = 7;
+            break;
+        }
+        catch (RingBufferStorageError&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Reading with a different element type must be refused.
+        try
+        {
+            RingBufferJournalReader< uint32_t > incompatible{ path.c_str() };
+
+            // If we make it here, it failed.
+            cout << "RingBufferJournalReader should have thrown an exception reading with an incompatible element type" << endl;
+            retVal = 8;
+            break;
+        }
+        catch (RingBufferStorageError&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Records survive the abrupt death of the writing process. The child exits without unwinding.
+        const pid_t pid = fork();
+        if ( -1 == pid )
+        {
+            cout << "RingBufferJournal test failed to fork" << endl;
+            retVal = 9;
+            break;
+        }
+        if ( 0 == pid )
+        {
+            int childRetVal = 0;
+            try
+            {
+                auto * pJournal = new RingBufferJournal< Record >{ path.c_str(), 8 };
+                for ( uint32_t i = 23; i != 1000; ++i ) pJournal->put( Record{ i, float( i ) } );
+            }
+            catch ( ... )
+            {
+                childRetVal = 1;
+            }
+            _exit( childRetVal );
+        }
+        int status = 0;
+        waitpid( pid, &status, 0 );
+        if ( !WIFEXITED( status ) || 0 != WEXITSTATUS( status ) )
+        {
+            cout << "RingBufferJournal writer process failed" << endl;
+            retVal = 10;
+            break;
+        }
+        if ( !isSequence( replayAll( path.c_str() ), 992, 999 ) )
+        {
+            cout << "RingBufferJournalReader should have replayed records 992 through 999 written by a dead process" << endl;
+            retVal = 11;
+            break;
+        }
+
+    } while ( false );
+
+    unlink( path.c_str() );
+    return retVal;
+}
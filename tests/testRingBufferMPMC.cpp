@@ -0,0 +1,155 @@
+//
+// Created by frank on 10/16/26.
+//
+
+#include "RingBufferMPMC.hpp"
+
+#include <iostream>
+#include <thread>
+#include <atomic>
+#include <vector>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+int main()
+{
+    int retVal = 0;
+    do {
+        // Create a ring buffer and verify that it has the correct size.  Ask for 3, should get 4
+        RingBufferMPMC<int> ringBuffer{3};
+        if ( ringBuffer.getSize() != 4 )
+        {
+            cout << "RingBufferMPMC should have a reported size of 4 and has a size of " << ringBuffer.getSize() << endl;
+            retVal = 1;
+            break;
+        }
+
+        // Attempt to get on empty ring buffer.  It should throw and tryGet should return no value.
+        try
+        {
+            ringBuffer.get();
+
+            // If we make it here, it failed.
+            cout << "RingBufferMPMC should have thrown an exception on get attempt with empty ring buffer" << endl;
+            retVal = 2;
+            break;
+        }
+        catch (RingBufferUnderflow&)
+        {
+            // If we make it here, it passed.
+        }
+        if ( ringBuffer.tryGet() )
+        {
+            cout << "RingBufferMPMC tryGet should have returned no value with empty ring buffer" << endl;
+            retVal = 3;
+            break;
+        }
+
+        // Cycle through the ring buffer several laps. Each lap, fill it with tryPut which should fail on the
+        // 5th attempt, verify put throws and then verify the contents come back in order.
+        for ( int lap = 0; lap != 3 && 0 == retVal; ++lap )
+        {
+            size_t i;
+            for (i = 0; i != 10; ++i)
+            {
+                if ( !ringBuffer.tryPut( lap * 10 + (int)i ) ) break;
+            }
+            if (i != 4)
+            {
+                cout << "RingBufferMPMC tryPut should have failed on the 5th attempt.  Iterator got to a value of " << i << endl;
+                retVal = 4;
+                break;
+            }
+            try
+            {
+                ringBuffer.put( 4 );
+
+                // If we make it here, it failed.
+                cout << "RingBufferMPMC should have thrown an exception on put attempt with full ring buffer" << endl;
+                retVal = 5;
+                break;
+            }
+            catch (RingBufferOverflow&)
+            {
+                // If we make it here, it passed.
+            }
+            for (i = 0; i != 4; ++i)
+            {
+                auto v = ringBuffer.tryGet();
+                if ( !v || *v != lap * 10 + (int)i )
+                {
+                    cout << "RingBufferMPMC \"tryGet\" should have returned " << lap * 10 + (int)i << endl;
+                    retVal = 6;
+                    break;
+                }
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Verify the typed pointer specialization round trips, including constant types.
+        const int someInts[2] = { 42, 43 };
+        RingBufferMPMC< const int * > ptrRingBuffer{2};
+        ptrRingBuffer.put( &someInts[0] );
+        if ( !ptrRingBuffer.tryPut( &someInts[1] ) || ptrRingBuffer.tryPut( &someInts[0] ) )
+        {
+            cout << "RingBufferMPMC< const int * > tryPut should succeed once and then fail on full" << endl;
+            retVal = 7;
+            break;
+        }
+        auto p = ptrRingBuffer.tryGet();
+        if ( !p || *p != &someInts[0] || ptrRingBuffer.get() != &someInts[1] )
+        {
+            cout << "RingBufferMPMC< const int * > did not return the pointers put" << endl;
+            retVal = 8;
+            break;
+        }
+
+        // Now several producer and consumer threads. Each producer puts a distinct range of values.
+        // Consumers tally what they receive. Every value must be received exactly once.
+        constexpr unsigned int numThreads = 4;
+        constexpr unsigned int numValuesPerProducer = 100000;
+        constexpr unsigned int numValues = numThreads * numValuesPerProducer;
+        RingBufferMPMC< unsigned int > threadedRingBuffer{ 64 };
+        vector< atomic< uint8_t > > tally( numValues );
+        atomic< unsigned int > numReceived{ 0 };
+
+        vector< thread > threads;
+        for ( unsigned int t = 0; t != numThreads; ++t )
+        {
+            threads.emplace_back( [&]()
+            {
+                while ( numReceived.load() != numValues )
+                {
+                    auto v = threadedRingBuffer.tryGet();
+                    if ( !v ) { this_thread::yield(); continue; }
+                    ++tally[ *v ];
+                    ++numReceived;
+                }
+            } );
+            threads.emplace_back( [&, t]()
+            {
+                const unsigned int first = t * numValuesPerProducer;
+                for ( unsigned int n = first; n != first + numValuesPerProducer; )
+                {
+                    if ( threadedRingBuffer.tryPut( n ) ) ++n;
+                    else this_thread::yield();
+                }
+            } );
+        }
+        for ( auto & t : threads ) t.join();
+
+        for ( unsigned int n = 0; n != numValues; ++n )
+        {
+            if ( tally[ n ] != 1 )
+            {
+                cout << "RingBufferMPMC value " << n << " was received " << unsigned( tally[ n ] ) << " times" << endl;
+                retVal = 9;
+                break;
+            }
+        }
+
+    } while ( false );
+
+    return retVal;
+}
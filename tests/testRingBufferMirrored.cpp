@@ -0,0 +1,134 @@
+//
+// Created by frank on 10/16/26.
+//
+
+#include "RingBufferMirrored.hpp"
+
+#include <iostream>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+int main()
+{
+    int retVal = 0;
+    do {
+        // Create a ring buffer of a few elements. It should be rounded up to a page worth of elements.
+        RingBufferMirrored<int> ringBuffer{3};
+        const size_t size = ringBuffer.getSize();
+        if ( size * sizeof( int ) != RingBufferMirroredStorage::getPageSize() )
+        {
+            cout << "RingBufferMirrored should have a page worth of elements and has a size of " << size << endl;
+            retVal = 1;
+            break;
+        }
+
+        // Attempt to get on empty ring buffer.  It should throw.
+        try
+        {
+            ringBuffer.get();
+
+            // If we make it here, it failed.
+            cout << "RingBufferMirrored should have thrown an exception on get when empty" << endl;
+            retVal = 2;
+            break;
+        }
+        catch (RingBufferUnderflow&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Fill it and attempt to put once more.  It should throw.
+        for ( size_t i = 0; i != size; ++i ) ringBuffer.put( int( i ) );
+        try
+        {
+            ringBuffer.put( 0 );
+
+            // If we make it here, it failed.
+            cout << "RingBufferMirrored should have thrown an exception on put when full" << endl;
+            retVal = 3;
+            break;
+        }
+        catch (RingBufferOverflow&)
+        {
+            // If we make it here, it passed.
+        }
+        if ( ringBuffer.tryPut( 0 ) )
+        {
+            cout << "RingBufferMirrored tryPut should have returned false when full" << endl;
+            retVal = 4;
+            break;
+        }
+
+        // Consume all but a few elements and put a few more, so that the elements available straddle the wrap point.
+        const size_t tail = 5;
+        ringBuffer.release( size - tail );
+        for ( size_t i = size; i != size + 11; ++i ) ringBuffer.put( int( i ) );
+
+        // A sliding window of 8 with a hop of 2 must see every window contiguously, across the wrap point.
+        const size_t windowLen = 8;
+        const size_t hop = 2;
+        int expected = int( size - tail );
+        while ( ringBuffer.getAvailableCount() >= windowLen )
+        {
+            auto window = ringBuffer.peekSpan( windowLen );
+            if ( window.size() != windowLen )
+            {
+                cout << "RingBufferMirrored peekSpan returned an unexpected size of " << window.size() << endl;
+                retVal = 5;
+                break;
+            }
+            for ( size_t i = 0; i != windowLen; ++i )
+            {
+                if ( window[ i ] != expected + int( i ) )
+                {
+                    cout << "RingBufferMirrored window element " << i << " should have been " << expected + int( i )
+                         << " and was " << window[ i ] << endl;
+                    retVal = 6;
+                    break;
+                }
+            }
+            if ( 0 != retVal ) break;
+            ringBuffer.release( hop );
+            expected += int( hop );
+        }
+        if ( 0 != retVal ) break;
+
+        // Reserve must likewise return the full room requested across the wrap point.
+        auto wSpan = ringBuffer.reserve( size );
+        if ( wSpan.size() != size - ringBuffer.getAvailableCount() )
+        {
+            cout << "RingBufferMirrored reserve returned an unexpected size of " << wSpan.size() << endl;
+            retVal = 7;
+            break;
+        }
+        for ( size_t i = 0; i != wSpan.size(); ++i ) wSpan[ i ] = expected + int( ringBuffer.getAvailableCount() + i );
+        ringBuffer.commit( wSpan.size() );
+
+        // Bulk get everything back out in one copy and verify.
+        const size_t count = ringBuffer.getAvailableCount();
+        auto pBuf = new int[ count ];
+        ringBuffer.get( pBuf, count );
+        for ( size_t i = 0; i != count; ++i )
+        {
+            if ( pBuf[ i ] != expected + int( i ) )
+            {
+                cout << "RingBufferMirrored bulk get element " << i << " should have been " << expected + int( i ) << endl;
+                retVal = 8;
+                break;
+            }
+        }
+        delete[] pBuf;
+        if ( 0 != retVal ) break;
+
+        if ( ringBuffer.tryGet() )
+        {
+            cout << "RingBufferMirrored tryGet should have returned no value when empty" << endl;
+            retVal = 9;
+            break;
+        }
+
+    } while ( false );
+
+    return retVal;
+}
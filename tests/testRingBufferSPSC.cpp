@@ -0,0 +1,170 @@
+//
+// Created by frank on 10/16/26.
+//
+
+#include "RingBufferSPSC.hpp"
+
+#include <iostream>
+#include <thread>
+#include <atomic>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+int main()
+{
+    int retVal = 0;
+    do {
+        // Create a ring buffer and verify that it has the correct size.  Ask for 3, should get 4
+        RingBufferSPSC<int> ringBuffer{3};
+        if ( ringBuffer.getSize() != 4 )
+        {
+            cout << "RingBufferSPSC should have a reported size of 4 and has a size of " << ringBuffer.getSize() << endl;
+            retVal = 1;
+            break;
+        }
+
+        // Attempt to get on empty ring buffer.  It should throw and tryGet should return no value.
+        try
+        {
+            ringBuffer.get();
+
+            // If we make it here, it failed.
+            cout << "RingBufferSPSC should have thrown an exception on get attempt with empty ring buffer" << endl;
+            retVal = 2;
+            break;
+        }
+        catch (RingBufferUnderflow&)
+        {
+            // If we make it here, it passed.
+        }
+        if ( ringBuffer.tryGet() )
+        {
+            cout << "RingBufferSPSC tryGet should have returned no value with empty ring buffer" << endl;
+            retVal = 3;
+            break;
+        }
+
+        // Fill the ring buffer with tryPut. It should fail on the 5th attempt and put should then throw.
+        size_t i;
+        for (i = 0; i != 10; ++i)
+        {
+            if ( !ringBuffer.tryPut( (int)i ) ) break;
+        }
+        if (i != 4)
+        {
+            cout << "RingBufferSPSC tryPut should have failed on the 5th attempt.  Iterator got to a value of " << i << endl;
+            retVal = 4;
+            break;
+        }
+        try
+        {
+            ringBuffer.put( 4 );
+
+            // If we make it here, it failed.
+            cout << "RingBufferSPSC should have thrown an exception on put attempt with full ring buffer" << endl;
+            retVal = 5;
+            break;
+        }
+        catch (RingBufferOverflow&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Test that the contents of the ring buffer are correct and in order.
+        for (i = 0; i != 4; ++i)
+        {
+            auto v = ringBuffer.tryGet();
+            if ( !v || size_t(*v) != i )
+            {
+                cout << "RingBufferSPSC \"tryGet\" should have returned " << i << endl;
+                retVal = 6;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Verify the typed pointer specialization round trips, including constant types.
+        const int someInts[2] = { 42, 43 };
+        RingBufferSPSC< const int * > ptrRingBuffer{2};
+        ptrRingBuffer.put( &someInts[0] );
+        if ( !ptrRingBuffer.tryPut( &someInts[1] ) || ptrRingBuffer.tryPut( &someInts[0] ) )
+        {
+            cout << "RingBufferSPSC< const int * > tryPut should succeed once and then fail on full" << endl;
+            retVal = 7;
+            break;
+        }
+        auto p = ptrRingBuffer.tryGet();
+        if ( !p || *p != &someInts[0] || ptrRingBuffer.get() != &someInts[1] )
+        {
+            cout << "RingBufferSPSC< const int * > did not return the pointers put" << endl;
+            retVal = 8;
+            break;
+        }
+
+        // Zero-copy reserve/commit and peekSpan/release. The ring buffer is empty with both counters at 4.
+        // A reserve for 4 returns all 4 slots and, after committing 3, a peekSpan for 4 returns the 3 committed.
+        auto wSpan = ringBuffer.reserve( 4 );
+        if ( wSpan.size() != 4 )
+        {
+            cout << "RingBufferSPSC reserve(4) should have returned 4 and returned " << wSpan.size() << endl;
+            retVal = 10;
+            break;
+        }
+        wSpan[0] = 7; wSpan[1] = 8; wSpan[2] = 9;
+        ringBuffer.commit( 3 );
+        auto rSpan = ringBuffer.peekSpan( 4 );
+        if ( rSpan.size() != 3 || rSpan[0] != 7 || rSpan[1] != 8 || rSpan[2] != 9 )
+        {
+            cout << "RingBufferSPSC peekSpan(4) should have returned the 3 committed" << endl;
+            retVal = 11;
+            break;
+        }
+        ringBuffer.release( 3 );
+        if ( ringBuffer.tryGet() || ringBuffer.reserve( 4 ).size() != 1 )
+        {
+            cout << "RingBufferSPSC should be empty with 1 contiguous slot before the wrap point" << endl;
+            retVal = 12;
+            break;
+        }
+
+        // Now one producer thread and one consumer thread. The consumer verifies that every value arrives in order.
+        constexpr unsigned int numValues = 1000000;
+        RingBufferSPSC< unsigned int > threadedRingBuffer{ 256 };
+        atomic< bool > outOfOrder{ false };
+
+        thread consumer{ [&]()
+        {
+            unsigned int expected = 0;
+            while ( expected != numValues )
+            {
+                auto v = threadedRingBuffer.tryGet();
+                if ( !v ) { this_thread::yield(); continue; }
+                if ( *v != expected ) { outOfOrder = true; break; }
+                ++expected;
+            }
+        } };
+
+        thread producer{ [&]()
+        {
+            for ( unsigned int n = 0; n != numValues && !outOfOrder; )
+            {
+                if ( threadedRingBuffer.tryPut( n ) ) ++n;
+                else this_thread::yield();
+            }
+        } };
+
+        producer.join();
+        consumer.join();
+
+        if ( outOfOrder )
+        {
+            cout << "RingBufferSPSC consumer thread received a value out of order" << endl;
+            retVal = 9;
+            break;
+        }
+
+    } while ( false );
+
+    return retVal;
+}
@@ -0,0 +1,211 @@
+//
+// Created by frank on 10/16/26.
+//
+
+#include "RingBufferShared.hpp"
+
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace ReiserRT::Core;
+
+namespace
+{
+    struct Sample
+    {
+        uint32_t sequence;
+        float value;
+    };
+}
+
+int main()
+{
+    int retVal = 0;
+    do {
+        // Create a ring buffer in an anonymous region and verify that it has the correct size.  Ask for 3, should get 4
+        RingBufferSharedRegion anonRegion{ RingBufferShared< int >::getRequiredBytes( 3 ) };
+        RingBufferShared< int > ringBuffer{ anonRegion, 3 };
+        if ( ringBuffer.getSize() != 4 )
+        {
+            cout << "RingBufferShared should have a reported size of 4 and has a size of " << ringBuffer.getSize() << endl;
+            retVal = 1;
+            break;
+        }
+
+        // Attempt to get on empty ring buffer.  It should throw.
+        try
+        {
+            ringBuffer.get();
+
+            // If we make it here, it failed.
+            cout << "RingBufferShared should have thrown an exception on get attempt with empty ring buffer" << endl;
+            retVal = 2;
+            break;
+        }
+        catch (RingBufferUnderflow&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // A second handle attached to the same region shares the same ring buffer.
+        RingBufferShared< int > attached{ anonRegion };
+        for ( int i = 0; i != 4; ++i ) ringBuffer.put( i );
+        if ( ringBuffer.tryPut( 4 ) || attached.getAvailableCount() != 4 )
+        {
+            cout << "RingBufferShared attached handle should have seen a full ring buffer" << endl;
+            retVal = 3;
+            break;
+        }
+        for ( int i = 0; i != 4; ++i )
+        {
+            if ( attached.get() != i )
+            {
+                cout << "RingBufferShared attached handle should have got " << i << endl;
+                retVal = 4;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Attaching with an incompatible element type must be refused.
+        try
+        {
+            RingBufferShared< double > incompatible{ anonRegion };
+
+            // If we make it here, it failed.
+            cout << "RingBufferShared should have thrown an exception attaching with an incompatible element type" << endl;
+            retVal = 5;
+            break;
+        }
+        catch (RingBufferStorageError&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Now a producer process and a consumer process. The parent creates a named region and ring buffer.
+        // The child attaches by name, at whatever address its own mapping lands, and produces.
+        // The parent consumes, verifying every sample arrives in order.
+        constexpr uint32_t numValues = 200000;
+        const string name = "/ReiserRT_testRingBufferShared_" + to_string( getpid() );
+        RingBufferSharedRegion namedRegion{ name.c_str(), RingBufferShared< Sample >::getRequiredBytes( 256 ) };
+        RingBufferShared< Sample > consumer{ namedRegion, 256 };
+
+        const pid_t pid = fork();
+        if ( -1 == pid )
+        {
+            cout << "RingBufferShared test failed to fork" << endl;
+            retVal = 6;
+            break;
+        }
+        if ( 0 == pid )
+        {
+            // Child. We exit without returning from main, so that no parent owned object is destroyed twice.
+            int childRetVal = 0;
+            try
+            {
+                RingBufferSharedRegion childRegion{ name.c_str() };
+                RingBufferShared< Sample > producer{ childRegion };
+                for ( uint32_t n = 0; n != numValues; )
+                {
+                    if ( producer.tryPut( Sample{ n, float( n ) * 0.5f } ) ) ++n;
+                    else this_thread::yield();
+                }
+            }
+            catch ( ... )
+            {
+                childRetVal = 1;
+            }
+            _exit( childRetVal );
+        }
+
+        // Parent.
+        int status = 0;
+        bool childExited = false;
+        for ( uint32_t expected = 0; expected != numValues && 0 == retVal; )
+        {
+            auto v = consumer.tryGet();
+            if ( v )
+            {
+                if ( v->sequence != expected || v->value != float( expected ) * 0.5f )
+                {
+                    cout << "RingBufferShared consumer process received a sample out of order" << endl;
+                    retVal = 7;
+                }
+                ++expected;
+                continue;
+            }
+
+            // Empty. If the child has exited and there is still nothing, it failed.
+            if ( childExited )
+            {
+                cout << "RingBufferShared producer process exited before producing all samples" << endl;
+                retVal = 8;
+            }
+            else if ( waitpid( pid, &status, WNOHANG ) == pid ) childExited = true;
+            else this_thread::yield();
+        }
+        if ( !childExited ) waitpid( pid, &status, 0 );
+        if ( 0 != retVal ) break;
+        if ( !WIFEXITED( status ) || 0 != WEXITSTATUS( status ) )
+        {
+            cout << "RingBufferShared producer process failed" << endl;
+            retVal = 9;
+            break;
+        }
+
+        // Creating a region whose name is in use must fail rather than truncate the live region.
+        try
+        {
+            RingBufferSharedRegion duplicateRegion{ name.c_str(), RingBufferShared< Sample >::getRequiredBytes( 256 ) };
+            cout << "RingBufferSharedRegion should have thrown RingBufferStorageError on an existing name" << endl;
+            retVal = 10;
+            break;
+        }
+        catch (RingBufferStorageError&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // A stale name, as left behind by a process that terminated abnormally, may be removed and then created.
+        const string staleName = name + "_stale";
+        const int staleFd = shm_open( staleName.c_str(), O_CREAT | O_RDWR, S_IRUSR | S_IWUSR );
+        if ( -1 != staleFd ) close( staleFd );
+        try
+        {
+            RingBufferSharedRegion staleRegion{ staleName.c_str(), RingBufferShared< int >::getRequiredBytes( 4 ) };
+            cout << "RingBufferSharedRegion should have thrown RingBufferStorageError on a stale name" << endl;
+            retVal = 11;
+            break;
+        }
+        catch (RingBufferStorageError&)
+        {
+            // If we make it here, it passed.
+        }
+        if ( !RingBufferSharedRegion::removeName( staleName.c_str() ) )
+        {
+            cout << "RingBufferSharedRegion::removeName failed to remove a stale name" << endl;
+            retVal = 11;
+            break;
+        }
+        RingBufferSharedRegion freshRegion{ staleName.c_str(), RingBufferShared< int >::getRequiredBytes( 4 ) };
+        RingBufferShared< int > freshRingBuffer{ freshRegion, 4 };
+        freshRingBuffer.put( 42 );
+        if ( freshRingBuffer.get() != 42 )
+        {
+            cout << "RingBufferShared in a region created after removing a stale name returned an unexpected value" << endl;
+            retVal = 11;
+            break;
+        }
+
+    } while ( false );
+
+    return retVal;
+}
@@ -84,6 +84,430 @@ int main()
         else if ( 0 != retVal)
             break;
 
+        // Bulk operations. Offset the counters by 3 so that a bulk put of 6 must wrap around the end of the buffer.
+        RingBufferSimple<int> bulkRingBuffer{8};
+        int src[10] = { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 };
+        int dst[10] = {};
+        bulkRingBuffer.put( src, 3 );
+        bulkRingBuffer.get( dst, 3 );
+        bulkRingBuffer.put( src, 6 );
+
+        // A bulk put of 3 more would overflow. It should throw and put nothing.
+        try
+        {
+            bulkRingBuffer.put( src, 3 );
+
+            // If we make it here, it failed.
+            cout << "RingBuffer should have thrown an exception on bulk \"put\" attempt of 3 with room for 2" << endl;
+            retVal = 6;
+            break;
+        }
+        catch (RingBufferOverflow&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // A bulk get of 7 would underflow. It should throw and get nothing.
+        try
+        {
+            bulkRingBuffer.get( dst, 7 );
+
+            // If we make it here, it failed.
+            cout << "RingBuffer should have thrown an exception on bulk \"get\" attempt of 7 with 6 available" << endl;
+            retVal = 7;
+            break;
+        }
+        catch (RingBufferUnderflow&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Fill the remaining 2 with scalar puts, then retrieve all 8 with a wrapping bulk get.
+        bulkRingBuffer.put( 16 );
+        bulkRingBuffer.put( 17 );
+        bulkRingBuffer.get( dst, 8 );
+        for (i = 0; i != 8; ++i)
+        {
+            if ( dst[i] != src[i] )
+            {
+                cout << "RingBuffer bulk \"get\" element " << i << " should have been " << src[i] << " and was " << dst[i] << endl;
+                retVal = 8;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Bulk operations through the typed pointer specialization.
+        RingBufferSimple< const int * > ptrRingBuffer{4};
+        const int * srcPtrs[3] = { &src[0], &src[1], &src[2] };
+        const int * dstPtrs[3] = {};
+        ptrRingBuffer.put( srcPtrs, 3 );
+        ptrRingBuffer.get( dstPtrs, 3 );
+        if ( dstPtrs[0] != srcPtrs[0] || dstPtrs[1] != srcPtrs[1] || dstPtrs[2] != srcPtrs[2] )
+        {
+            cout << "RingBuffer< const int * > bulk operations did not return the pointers put" << endl;
+            retVal = 9;
+            break;
+        }
+
+
+        // Compile time capacity. Ask for 5, should get 8 with no heap allocated element buffer.
+        static RingBufferSimple< int, 5 > fixedRingBuffer;
+        static_assert( sizeof( RingBufferSimple< int, 5 > ) >= 8 * sizeof( int ),
+                "RingBufferSimple< int, 5 > should hold its 8 elements inline" );
+        if ( fixedRingBuffer.getSize() != 8 || fixedRingBuffer.getMask() != 7 || fixedRingBuffer.getNumBits() != 3 )
+        {
+            cout << "RingBufferSimple< int, 5 > should have a size of 8 and has a size of " << fixedRingBuffer.getSize() << endl;
+            retVal = 10;
+            break;
+        }
+
+        // Cycle through the fixed ring buffer several laps, verifying order and that it throws on the 9th "put".
+        for ( int lap = 0; lap != 3 && 0 == retVal; ++lap )
+        {
+            for (i = 0; i != 8; ++i) fixedRingBuffer.put( lap * 10 + (int)i );
+            try
+            {
+                fixedRingBuffer.put( 0 );
+
+                // If we make it here, it failed.
+                cout << "RingBufferSimple< int, 5 > should have thrown an exception on the 9th \"put\" attempt" << endl;
+                retVal = 11;
+                break;
+            }
+            catch (RingBufferOverflow&)
+            {
+                // If we make it here, it passed.
+            }
+            for (i = 0; i != 8; ++i)
+            {
+                int v = fixedRingBuffer.get();
+                if ( v != lap * 10 + (int)i )
+                {
+                    cout << "RingBufferSimple< int, 5 > \"get\" should have returned " << lap * 10 + (int)i << " and returned " << v << endl;
+                    retVal = 12;
+                    break;
+                }
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Compile time capacity through the typed pointer specialization.
+        RingBufferSimple< const int *, 2 > fixedPtrRingBuffer;
+        fixedPtrRingBuffer.put( &src[0] );
+        if ( fixedPtrRingBuffer.get() != &src[0] )
+        {
+            cout << "RingBufferSimple< const int *, 2 > did not return the pointer put" << endl;
+            retVal = 13;
+            break;
+        }
+
+        // Large capacities. The 32 bit counter type is no longer clamped at 2^20 and a 64 bit counter type supports
+        // capacities beyond 2^32. We verify the sizing arithmetic without allocating such a beast.
+        static_assert( RingBufferSizing<>::maxElements == ( uint32_t( 1 ) << 31 ),
+                "RingBufferSizing< uint32_t > should support 2^31 elements" );
+        static_assert( RingBufferSizing< uint64_t >::numBitsForNE( ( size_t( 1 ) << 32 ) + 1 ) == 33,
+                "RingBufferSizing< uint64_t > should support more than 2^32 elements" );
+        static_assert( RingBufferSizing< uint64_t >::maskForNB( 33 ) == ( uint64_t( 1 ) << 33 ) - 1,
+                "RingBufferSizing< uint64_t > mask for 33 bits is incorrect" );
+
+        RingBufferSimple< int > beyondOldCapRingBuffer{ ( 1 << 20 ) + 1 };
+        if ( beyondOldCapRingBuffer.getSize() != ( 1 << 21 ) )
+        {
+            cout << "RingBufferSimple< int > should have a size of 2^21 and has a size of " << beyondOldCapRingBuffer.getSize() << endl;
+            retVal = 14;
+            break;
+        }
+
+        // A 64 bit counter ring buffer must behave identically. Its counters roll over from the start as well.
+        RingBufferSimple< int, 0, uint64_t > wideRingBuffer{3};
+        for ( int lap = 0; lap != 3 && 0 == retVal; ++lap )
+        {
+            wideRingBuffer.put( src, 4 );
+            try
+            {
+                wideRingBuffer.put( 0 );
+
+                // If we make it here, it failed.
+                cout << "RingBufferSimple< int, 0, uint64_t > should have thrown an exception on the 5th \"put\" attempt" << endl;
+                retVal = 15;
+                break;
+            }
+            catch (RingBufferOverflow&)
+            {
+                // If we make it here, it passed.
+            }
+            for (i = 0; i != 4; ++i)
+            {
+                if ( wideRingBuffer.get() != src[i] )
+                {
+                    cout << "RingBufferSimple< int, 0, uint64_t > \"get\" should have returned " << src[i] << endl;
+                    retVal = 16;
+                    break;
+                }
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Small, trivially copyable records are stored inline, by value. Including bulk operations which wrap.
+        struct TimeStampedValue { uint64_t timeStamp; double value; };
+        RingBufferSimple< TimeStampedValue > recordRingBuffer{4};
+        TimeStampedValue srcRecords[4] = { { 1, 1.5 }, { 2, 2.5 }, { 3, 3.5 }, { 4, 4.5 } };
+        TimeStampedValue dstRecords[4] = {};
+        recordRingBuffer.put( srcRecords[0] );
+        recordRingBuffer.get();
+        recordRingBuffer.put( srcRecords, 4 );
+        recordRingBuffer.get( dstRecords, 4 );
+        for (i = 0; i != 4; ++i)
+        {
+            if ( dstRecords[i].timeStamp != srcRecords[i].timeStamp || dstRecords[i].value != srcRecords[i].value )
+            {
+                cout << "RingBufferSimple< TimeStampedValue > element " << i << " was not returned intact" << endl;
+                retVal = 17;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Exception free operations. Empty and full are reported, not thrown.
+        RingBufferSimple< int > tryRingBuffer{4};
+        if ( tryRingBuffer.tryGet() )
+        {
+            cout << "RingBufferSimple tryGet should have returned no value with empty ring buffer" << endl;
+            retVal = 18;
+            break;
+        }
+        for (i = 0; i != 10; ++i)
+        {
+            if ( !tryRingBuffer.tryPut( (int)i ) ) break;
+        }
+        if (i != 4)
+        {
+            cout << "RingBufferSimple tryPut should have failed on the 5th attempt.  Iterator got to a value of " << i << endl;
+            retVal = 19;
+            break;
+        }
+        for (i = 0; i != 4; ++i)
+        {
+            auto v = tryRingBuffer.tryGet();
+            if ( !v || size_t(*v) != i )
+            {
+                cout << "RingBufferSimple \"tryGet\" should have returned " << i << endl;
+                retVal = 20;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Exception free operations through the typed pointer specialization.
+        RingBufferSimple< const int * > tryPtrRingBuffer{2};
+        if ( !tryPtrRingBuffer.tryPut( &src[0] ) || !tryPtrRingBuffer.tryPut( &src[1] ) || tryPtrRingBuffer.tryPut( &src[2] ) )
+        {
+            cout << "RingBufferSimple< const int * > tryPut should succeed twice and then fail on full" << endl;
+            retVal = 21;
+            break;
+        }
+        auto p = tryPtrRingBuffer.tryGet();
+        if ( !p || *p != &src[0] )
+        {
+            cout << "RingBufferSimple< const int * > tryGet did not return the pointer put" << endl;
+            retVal = 22;
+            break;
+        }
+
+        // Zero-copy reserve/commit and peekSpan/release. Offset the counters by 6 so the wrap point is reached.
+        RingBufferSimple< int > zcRingBuffer{8};
+        zcRingBuffer.put( src, 6 );
+        zcRingBuffer.get( dst, 6 );
+        auto wSpan = zcRingBuffer.reserve( 5 );
+        if ( wSpan.size() != 2 )
+        {
+            cout << "RingBufferSimple reserve(5) should have been limited to 2 by the wrap point and was " << wSpan.size() << endl;
+            retVal = 23;
+            break;
+        }
+        wSpan[0] = 100; wSpan[1] = 101;
+        zcRingBuffer.commit( wSpan.size() );
+        wSpan = zcRingBuffer.reserve( 10 );
+        if ( wSpan.size() != 6 )
+        {
+            cout << "RingBufferSimple reserve(10) should have been limited to 6 by the room available and was " << wSpan.size() << endl;
+            retVal = 24;
+            break;
+        }
+        int n = 102;
+        for ( auto & v : wSpan ) v = n++;
+        zcRingBuffer.commit( wSpan.size() );
+        if ( !zcRingBuffer.reserve( 1 ).empty() )
+        {
+            cout << "RingBufferSimple reserve should have returned an empty span when full" << endl;
+            retVal = 25;
+            break;
+        }
+        try
+        {
+            zcRingBuffer.commit( 1 );
+
+            // If we make it here, it failed.
+            cout << "RingBufferSimple should have thrown an exception on commit when full" << endl;
+            retVal = 26;
+            break;
+        }
+        catch (RingBufferOverflow&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Consume in place. The first span is limited by the wrap point, the second is the remainder.
+        n = 100;
+        for ( size_t pass = 0; pass != 2 && 0 == retVal; ++pass )
+        {
+            auto rSpan = zcRingBuffer.peekSpan( 8 );
+            if ( rSpan.size() != ( pass == 0 ? 2U : 6U ) )
+            {
+                cout << "RingBufferSimple peekSpan pass " << pass << " returned an unexpected size of " << rSpan.size() << endl;
+                retVal = 27;
+                break;
+            }
+            for ( auto v : rSpan )
+            {
+                if ( v != n++ )
+                {
+                    cout << "RingBufferSimple peekSpan returned an unexpected value of " << v << endl;
+                    retVal = 28;
+                    break;
+                }
+            }
+            zcRingBuffer.release( rSpan.size() );
+        }
+        if ( 0 != retVal ) break;
+        try
+        {
+            zcRingBuffer.release( 1 );
+
+            // If we make it here, it failed.
+            cout << "RingBufferSimple should have thrown an exception on release when empty" << endl;
+            retVal = 29;
+            break;
+        }
+        catch (RingBufferUnderflow&)
+        {
+            // If we make it here, it passed.
+        }
+
+        // Rings backed by mapped, pre-faulted storage must behave as those backed by the heap.
+        RingBufferStorageOptions options{};
+        options.prefault = true;
+        RingBufferSimple<int> mappedRingBuffer{ 1024, options };
+        for ( int i = 0; i != 1024; ++i ) mappedRingBuffer.put( i );
+        for ( int i = 0; i != 1024; ++i )
+        {
+            if ( mappedRingBuffer.get() != i )
+            {
+                cout << "RingBufferSimple with pre-faulted storage returned an unexpected value" << endl;
+                retVal = 30;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Locked memory may be refused by our resource limits. If so, we expect a RingBufferStorageError.
+        try
+        {
+            options.lockMemory = true;
+            RingBufferSimple<int> lockedRingBuffer{ 16, options };
+            lockedRingBuffer.put( 42 );
+            if ( lockedRingBuffer.get() != 42 )
+            {
+                cout << "RingBufferSimple with locked storage returned an unexpected value" << endl;
+                retVal = 31;
+                break;
+            }
+        }
+        catch (RingBufferStorageError&)
+        {
+            // Acceptable. Our environment does not allow locking memory.
+        }
+
+        // Overwrite mode. Putting into a full ring buffer evicts the oldest element.
+        RingBufferSimple<int> lossyRingBuffer{ 4 };
+        for ( int i = 0; i != 6; ++i )
+        {
+            auto evicted = lossyRingBuffer.putOverwrite( i );
+            if ( ( i < 4 && evicted ) || ( i >= 4 && ( !evicted || *evicted != i - 4 ) ) )
+            {
+                cout << "RingBufferSimple putOverwrite evicted unexpectedly on put of " << i << endl;
+                retVal = 32;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+        for ( int i = 2; i != 6; ++i )
+        {
+            if ( lossyRingBuffer.get() != i )
+            {
+                cout << "RingBufferSimple get after putOverwrite should have returned " << i << endl;
+                retVal = 33;
+                break;
+            }
+        }
+        if ( 0 != retVal ) break;
+
+        // Non-consuming peek and iteration. Offset the counters so the occupied range wraps around.
+        RingBufferSimple<int> peekRingBuffer{ 4 };
+        for ( int i = 0; i != 3; ++i ) { peekRingBuffer.put( -1 ); peekRingBuffer.get(); }
+        if ( peekRingBuffer.peek() || peekRingBuffer.begin() != peekRingBuffer.end() )
+        {
+            cout << "RingBufferSimple peek of an empty ring buffer should have had no value" << endl;
+            retVal = 34;
+            break;
+        }
+        for ( int i = 10; i != 13; ++i ) peekRingBuffer.put( i );
+        if ( peekRingBuffer.getAvailableCount() != 3 || *peekRingBuffer.peek() != 10 ||
+             *peekRingBuffer.peek( 2 ) != 12 || peekRingBuffer.peek( 3 ) )
+        {
+            cout << "RingBufferSimple peek returned unexpected values" << endl;
+            retVal = 35;
+            break;
+        }
+        int sum = 0;
+        int expected = 10;
+        for ( auto v : peekRingBuffer )
+        {
+            if ( v != expected++ ) retVal = 36;
+            sum += v;
+        }
+        if ( 0 != retVal || sum != 33 || peekRingBuffer.getAvailableCount() != 3 || peekRingBuffer.get() != 10 )
+        {
+            cout << "RingBufferSimple iteration should have visited 10 through 12 without consuming them" << endl;
+            retVal = 36;
+            break;
+        }
+
+        // Typed pointer peek.
+        RingBufferSimple<const int*> peekPtrRingBuffer{ 2 };
+        const int anInt = 7;
+        peekPtrRingBuffer.put( &anInt );
+        if ( peekPtrRingBuffer.peek() != &anInt || peekPtrRingBuffer.getAvailableCount() != 1 )
+        {
+            cout << "RingBufferSimple typed pointer peek returned an unexpected value" << endl;
+            retVal = 37;
+            break;
+        }
+
+        // A 64 bit counter permits more elements than size_t can express in bytes. This must be rejected,
+        // not wrapped around to a small allocation.
+        try
+        {
+            RingBufferSimple<uint64_t, 0, uint64_t> hugeRingBuffer{ SIZE_MAX };
+            cout << "RingBufferSimple should have thrown RingBufferStorageError on byte count overflow" << endl;
+            retVal = 38;
+            break;
+        }
+        catch (RingBufferStorageError&)
+        {
+            // Expected.
+        }
 
     } while ( false );
 
@@ -4,6 +4,7 @@
 
 // What we are testing
 #include "Semaphore.hpp"
+#include "ReiserRT_CoreExceptions.hpp"
 
 // Test task class specifications for give and taking the semaphore.
 #include "SemTestTasks.h"
@@ -13,6 +14,10 @@
 #include <iostream>
 #include <memory>
 #include <thread>
+#include <chrono>
+
+#include <sys/wait.h>
+#include <unistd.h>
 
 using namespace ReiserRT::Core;
 using namespace std;
@@ -110,6 +115,242 @@ int main() {
             }
         }
 
+        // Non-blocking take and give with functor interface. The functor is only invoked upon success.
+        {
+            Semaphore sem{ 0, 1 };
+            size_t callbackCount = 0;
+            auto funk = [&callbackCount]() { ++callbackCount; };
+
+            if ( sem.tryTake(std::ref(funk)) || 0 != callbackCount )
+            {
+                cout << "Semaphore tryTake should have failed without invoking callback when unavailable!" << endl;
+                retVal = 20;
+                break;
+            }
+            if ( !sem.tryGive(std::ref(funk)) || 1 != callbackCount || sem.getAvailableCount() != 1 )
+            {
+                cout << "Semaphore tryGive should have succeeded and invoked callback!" << endl;
+                retVal = 21;
+                break;
+            }
+            if ( sem.tryGive(std::ref(funk)) || 1 != callbackCount )
+            {
+                cout << "Semaphore tryGive should have failed without invoking callback at maximum available count!" << endl;
+                retVal = 22;
+                break;
+            }
+            if ( !sem.tryTake(std::ref(funk)) || 2 != callbackCount || sem.getAvailableCount() != 0 )
+            {
+                cout << "Semaphore tryTake should have succeeded and invoked callback!" << endl;
+                retVal = 23;
+                break;
+            }
+        }
+
+        // Timed take and give with functor interface. The functor is only invoked upon success before the deadline.
+        {
+            Semaphore sem{ 0, 1 };
+            size_t callbackCount = 0;
+            auto funk = [&callbackCount]() { ++callbackCount; };
+
+            const auto deadline = chrono::steady_clock::now() + chrono::milliseconds{ 20 };
+            if ( sem.tryTakeUntil(std::ref(funk), deadline) || 0 != callbackCount || chrono::steady_clock::now() < deadline )
+            {
+                cout << "Semaphore tryTakeUntil should have timed out at its deadline without invoking callback!" << endl;
+                retVal = 26;
+                break;
+            }
+            if ( !sem.tryGiveUntil(std::ref(funk), deadline) || 1 != callbackCount ||
+                 sem.tryGiveUntil(std::ref(funk), chrono::steady_clock::now() + chrono::milliseconds{ 20 }) || 1 != callbackCount )
+            {
+                cout << "Semaphore tryGiveUntil should have succeeded once and then timed out at maximum available count!" << endl;
+                retVal = 27;
+                break;
+            }
+            if ( !sem.tryTakeUntil(std::ref(funk), deadline) || 2 != callbackCount || sem.getAvailableCount() != 0 )
+            {
+                cout << "Semaphore tryTakeUntil should have succeeded without waiting and invoked callback!" << endl;
+                retVal = 28;
+                break;
+            }
+        }
+
+        // Take available with counted functor interface. Everything available, up to the maximum, is taken at once.
+        {
+            Semaphore sem{ 5 };
+            size_t takenCount = 0;
+            auto funk = [&takenCount]( size_t count ) { takenCount = count; };
+
+            if ( sem.takeAvailable(std::ref(funk), 3) != 3 || 3 != takenCount || sem.getAvailableCount() != 2 ||
+                 sem.takeAvailable(std::ref(funk), 10) != 2 || 2 != takenCount || sem.getAvailableCount() != 0 )
+            {
+                cout << "Semaphore takeAvailable should have taken 3 and then the remaining 2!" << endl;
+                retVal = 29;
+                break;
+            }
+            if ( sem.takeAvailable(std::ref(funk), 0) != 0 )
+            {
+                cout << "Semaphore takeAvailable should have taken nothing with a maximum count of zero!" << endl;
+                retVal = 30;
+                break;
+            }
+        }
+
+        // Counted take and give. Counts are taken and given all at once.
+        {
+            Semaphore sem{ 0, 8 };
+            size_t callbackCount = 0;
+            auto funk = [&callbackCount]() { ++callbackCount; };
+
+            sem.give( 5 );
+            sem.take( 3 );
+            if ( sem.getAvailableCount() != 2 )
+            {
+                cout << "Semaphore give(5) and take(3) should have left 2 available!" << endl;
+                retVal = 31;
+                break;
+            }
+            sem.take( std::ref(funk), 2 );
+            sem.give( std::ref(funk), 6 );
+            sem.take( std::ref(funk), 0 );
+            if ( sem.getAvailableCount() != 6 || 2 != callbackCount )
+            {
+                cout << "Semaphore counted functor operations should have left 6 available and invoked callback twice!" << endl;
+                retVal = 32;
+                break;
+            }
+            try
+            {
+                sem.take( 9 );
+                cout << "Semaphore take(9) should have thrown exceeding its maximum available count!" << endl;
+                retVal = 33;
+                break;
+            }
+            catch ( const SemaphoreOverflow & ) {}
+
+            // A counted take waits until all of its count is available, one single give at a time.
+            thread takeThread{ [&sem]() { sem.take( 8 ); } };
+            this_thread::sleep_for( chrono::milliseconds{ 20 } );
+            sem.give();
+            sem.give();
+            takeThread.join();
+            if ( sem.getAvailableCount() != 0 )
+            {
+                cout << "Semaphore take(8) should have taken everything given!" << endl;
+                retVal = 34;
+                break;
+            }
+        }
+
+        // Timed and non-blocking take and give without functor interface.
+        {
+            Semaphore sem{ 0, 1 };
+            size_t callbackCount = 0;
+            auto funk = [&callbackCount]() { ++callbackCount; };
+
+            if ( sem.tryTake() || !sem.tryGive() || sem.tryGive() || sem.getAvailableCount() != 1 )
+            {
+                cout << "Semaphore tryTake should have failed when empty and tryGive when full!" << endl;
+                retVal = 35;
+                break;
+            }
+            auto start = chrono::steady_clock::now();
+            if ( sem.tryGiveFor( chrono::milliseconds{ 20 } ) || chrono::steady_clock::now() - start < chrono::milliseconds{ 20 } ||
+                 !sem.tryTakeFor( chrono::milliseconds{ 20 } ) || sem.getAvailableCount() != 0 )
+            {
+                cout << "Semaphore tryGiveFor should have timed out when full and tryTakeFor succeeded at once!" << endl;
+                retVal = 36;
+                break;
+            }
+            start = chrono::steady_clock::now();
+            if ( sem.tryTakeFor( std::ref(funk), chrono::microseconds{ 20500 } ) || 0 != callbackCount ||
+                 chrono::steady_clock::now() - start < chrono::microseconds{ 20500 } )
+            {
+                cout << "Semaphore tryTakeFor should have timed out when empty without invoking callback!" << endl;
+                retVal = 37;
+                break;
+            }
+            if ( !sem.tryGiveFor( std::ref(funk), chrono::milliseconds{ 20 } ) || !sem.tryTake() || !sem.tryGiveUntil(
+                chrono::steady_clock::now() + chrono::milliseconds{ 20 } ) || !sem.tryTakeUntil( chrono::steady_clock::now() ) ||
+                1 != callbackCount || sem.getAvailableCount() != 0 )
+            {
+                cout << "Semaphore timed operations should have succeeded without waiting!" << endl;
+                retVal = 38;
+                break;
+            }
+        }
+
+        // Contended take and give within a forked child. The child must not be mistaken for its parent
+        // by the Semaphore's lock.
+        {
+            const pid_t pid = fork();
+            if ( pid < 0 )
+            {
+                cout << "Semaphore test failed to fork" << endl;
+                retVal = 39;
+                break;
+            }
+            if ( pid == 0 )
+            {
+                Semaphore sem{ 0, 1 };
+                constexpr unsigned int numGives = 100000;
+                thread giveThread{ [&sem]() { for ( unsigned int n = 0; n != numGives; ++n ) sem.give(); } };
+                for ( unsigned int n = 0; n != numGives; ++n ) sem.take();
+                giveThread.join();
+                _exit( sem.getAvailableCount() == 0 ? 0 : 1 );
+            }
+            int status = 0;
+            waitpid( pid, &status, 0 );
+            if ( !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 )
+            {
+                cout << "Semaphore contended take and give within a forked child failed!" << endl;
+                retVal = 39;
+                break;
+            }
+        }
+
+        // A timeout too large to be represented as a deadline waits as if forever, rather than overflowing
+        // into a deadline already passed.
+        {
+            Semaphore sem{ 0, 1 };
+            thread giveThread{ [&sem]() { this_thread::sleep_for( chrono::milliseconds{ 20 } ); sem.give(); } };
+            const bool took = sem.tryTakeFor( chrono::hours::max() );
+            giveThread.join();
+            sem.give();
+            thread takeThread{ [&sem]() { this_thread::sleep_for( chrono::milliseconds{ 20 } ); sem.take(); } };
+            const bool gave = sem.tryGiveFor( chrono::hours::max() );
+            takeThread.join();
+            if ( !took || !gave || sem.getAvailableCount() != 1 )
+            {
+                cout << "Semaphore tryTakeFor and tryGiveFor with a maximal timeout should have waited!" << endl;
+                retVal = 40;
+                break;
+            }
+        }
+
+        // Give or replace. The replace functor is invoked instead of waiting at the maximum available count.
+        {
+            Semaphore sem{ 0, 1 };
+            size_t giveCount = 0;
+            size_t replaceCount = 0;
+            auto giveFunk = [&giveCount]() { ++giveCount; };
+            auto replaceFunk = [&replaceCount]() { ++replaceCount; };
+
+            if ( !sem.giveOrReplace(std::ref(giveFunk), std::ref(replaceFunk)) || 1 != giveCount || 0 != replaceCount )
+            {
+                cout << "Semaphore giveOrReplace should have given below the maximum available count!" << endl;
+                retVal = 24;
+                break;
+            }
+            if ( sem.giveOrReplace(std::ref(giveFunk), std::ref(replaceFunk)) || 1 != giveCount || 1 != replaceCount ||
+                 sem.getAvailableCount() != 1 )
+            {
+                cout << "Semaphore giveOrReplace should have replaced at the maximum available count!" << endl;
+                retVal = 25;
+                break;
+            }
+        }
+
         // Simple pending/abort testing with one take thread running alongside this thread.
         {
             Semaphore sem{0};  // Initially empty